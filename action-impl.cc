@@ -0,0 +1,16 @@
+// Action module - implementation
+module action;
+
+import <string>;
+
+std::string commandName(Action action) {
+    switch (action) {
+        case Action::Left: return "left";
+        case Action::Right: return "right";
+        case Action::Down: return "down";
+        case Action::Clockwise: return "cw";
+        case Action::CounterClockwise: return "ccw";
+        case Action::Drop: return "drop";
+    }
+    return "";
+}
@@ -0,0 +1,83 @@
+/**
+ * @file action.cc
+ * @brief Interface for the Action enumeration (typed player commands)
+ *
+ * Actions are the typed form of the movement commands a player can issue
+ * during a turn. Bots and the move generator work with Actions; they can be
+ * turned back into the command text a player types.
+ *
+ * Commands extend Actions with the rest of the game's commands. Text input
+ * is parsed into a Command once, by CommandInterpreter; Game and Player
+ * only ever see the typed form.
+ */
+
+export module action;
+
+import <cstdint>;
+import <string>;
+
+/**
+ * @enum Action
+ * @brief One command applied to the current block
+ */
+export enum class Action : std::uint8_t {
+    Left,               ///< Move one column left ("left")
+    Right,              ///< Move one column right ("right")
+    Down,               ///< Move one row down ("down")
+    Clockwise,          ///< Rotate clockwise ("cw")
+    CounterClockwise,   ///< Rotate counter-clockwise ("ccw")
+    Drop                ///< Hard drop and end the turn ("drop")
+};
+
+/**
+ * @brief Gets the game command string for an action
+ * @param action The action to convert
+ * @return Command text accepted by CommandInterpreter (e.g. "left", "cw")
+ */
+export std::string commandName(Action action);
+
+/**
+ * @enum CommandType
+ * @brief Every command Game::handleCommand accepts
+ *
+ * The first six values are the Actions, in the same order, so an Action
+ * converts to its CommandType by value. Only the values before Drop repeat
+ * with a multiplier, and Hint through Phantom are the special commands.
+ */
+export enum class CommandType : std::uint8_t {
+    Left,               ///< Move one column left
+    Right,              ///< Move one column right
+    Down,               ///< Move one row down
+    Clockwise,          ///< Rotate clockwise
+    CounterClockwise,   ///< Rotate counter-clockwise
+    Drop,               ///< Hard drop and end the turn
+    Hold,               ///< Swap the current block with the held one
+    LevelUp,            ///< Raise the level by one
+    LevelDown,          ///< Lower the level by one
+    Block,              ///< Replace the current block (testing: I, J, L, ...)
+    Hint,               ///< Show the best placement of the current block
+    NoRandom,           ///< Read blocks from a file (Levels 3 and 4)
+    Random,             ///< Restore random blocks (Levels 3 and 4)
+    Sequence,           ///< Read commands from a file
+    Restart,            ///< Start a new game
+    Phantom,            ///< Toggle the phantom block (graphics only)
+    Unknown             ///< Input that matched no command
+};
+
+/**
+ * @struct Command
+ * @brief A parsed command
+ */
+export struct Command {
+    CommandType type = CommandType::Unknown;  ///< Which command
+    char block = 0;                           ///< Block type, for CommandType::Block
+
+    constexpr Command() = default;
+    constexpr Command(CommandType type, char block = 0) : type{type}, block{block} {}
+
+    /// An Action is the Command of the same name
+    constexpr Command(Action action) : type{static_cast<CommandType>(action)} {}
+};
+
+static_assert(Command{Action::Drop}.type == CommandType::Drop &&
+              Command{Action::CounterClockwise}.type == CommandType::CounterClockwise);
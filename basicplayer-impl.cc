@@ -1,30 +1,32 @@
 // BasicPlayer module - implementation
 module basicplayer;
 
+import <algorithm>;
+import <cstdint>;
 import <memory>;
+import <optional>;
 import <string>;
+import <utility>;
+import action;
 import player;
 import board;
 import block;
-import iblock;
-import jblock;
-import lblock;
-import oblock;
-import sblock;
-import tblock;
-import zblock;
 import level;
 import level0;
 import level1;
 import level2;
 import level3;
 import level4;
+import observer;
 import position;
+import rng;
 import subject;
 
 BasicPlayer::BasicPlayer() : Player{} {
     board = std::make_shared<Board>();
-    level = std::make_shared<Level0>();
+    levels = {std::make_shared<Level0>(), std::make_shared<Level1>(), std::make_shared<Level2>(),
+              std::make_shared<Level3>(), std::make_shared<Level4>()};
+    selectLevel(0);
     lastRowsCleared = 0;
     // Don't generate next block yet - will be generated after script files are set
 }
@@ -33,60 +35,87 @@ std::shared_ptr<Board> BasicPlayer::getBoard() { return board; }
 int BasicPlayer::getScore() const { return score; }
 int BasicPlayer::getLevel() const { return levelNum; }
 bool BasicPlayer::isAlive() const { return alive; }
-std::shared_ptr<Block> BasicPlayer::getCurBlock() { return curBlock; }
-std::shared_ptr<Block> BasicPlayer::getNextBlock() { return nextBlock; }
-std::shared_ptr<Block> BasicPlayer::getHeldBlock() { return heldBlock; }
+const Block* BasicPlayer::getCurBlock() const { return curBlock ? &*curBlock : nullptr; }
+const Block* BasicPlayer::getNextBlock() const { return nextBlock ? &*nextBlock : nullptr; }
+const Block* BasicPlayer::getHeldBlock() const { return heldBlock ? &*heldBlock : nullptr; }
 Position BasicPlayer::getCurPos() const { return curPos; }
 
 void BasicPlayer::generateNextBlock() {
-    nextBlock = level->generateBlock(++blockIdCounter);
-    notifyObservers();  // Notify observers when next block is generated
+    nextBlock = level->generateBlock(++blockIdCounter, rng);
+    publish(NextChanged{nextBlock->getSymbol()});
+    notifyChanges(Changes{0, Changes::Next});  // Notify observers when next block is generated
 }
 
 bool BasicPlayer::spawnBlock() {
-    curBlock = std::move(nextBlock);
+    // A pending force replaces the block about to spawn
+    if (effects & ForcePending) {
+        nextBlock = Block{nextBlock->getId(), forcedType, levelNum};
+        effects &= ~ForcePending;
+        publish(NextChanged{forcedType});
+        notifyChanges(Changes{0, Changes::Next});  // Notify observers when next block changes
+    }
+    // Blind is on for the whole turn, so turn it on before spawning
+    if (effects & Blinded) {
+        board->setBlind(true);
+        markChanged(Changes{Changes::ALL_ROWS, 0});
+    }
+    
+    // Spawn below the 3 reserve rows (row 3), column 0 (top-left)
+    curBlock = nextBlock;
+    curPos = Position{3, 0};
+    publish(PieceSpawned{curBlock->getSymbol(), curPos});
     generateNextBlock();
     
     // Reset lock delay state for new block
     isLocked = false;
     lockDelayMoveUsed = false;
     
-    // Spawn below the 3 reserve rows (row 3), column 0 (top-left)
-    curPos = Position{3, 0};
-    
     if (!board->canPlace(*curBlock, curPos)) {
         alive = false;
-        notifyObservers();  // Notify observers of state change
+        publish(PlayerLost{});
+        notifyChanges(Changes{});  // Notify observers of state change
         return false;
     }
     
-    notifyObservers();  // Notify observers when block is spawned
+    notifyChanges(Changes{});  // Notify observers when block is spawned
     return true;
 }
 
-bool BasicPlayer::move(const std::string& dir) {
-    Position newPos = curPos;
+bool BasicPlayer::move(Action dir, int times) {
+    if (times <= 0) return false;
     
-    if (dir == "left") newPos.col--;
-    else if (dir == "right") newPos.col++;
-    else if (dir == "down") newPos.row++;
+    if (dir == Action::Down) {
+        // Down never triggers gravity, so `times` rows is one bounded fall
+        int rows = std::min(times, board->dropDistance(*curBlock, curPos));
+        if (rows == 0) return false;
+        Position from = curPos;
+        curPos.row += rows;
+        publish(PieceMoved{from, curPos});
+        notifyChanges(Changes{});
+        return true;
+    }
     
-    if (board->canPlace(*curBlock, newPos)) {
-        curPos = newPos;
-        notifyObservers();  // Notify observers when block moves
+    // Left/right: each step shifts one column, then falls the Level 3/4
+    // heavy row and the heavy effects' rows. A step that cannot shift leaves
+    // the block where it was, so every later step would fail too; the loop
+    // therefore runs at most once per board column, whatever `times` is.
+    int shift = (dir == Action::Left) ? -1 : 1;
+    bool levelHeavy = (levelNum == 3 || levelNum == 4);
+    bool moved = false;
+    Position from = curPos;
+    for (int i = 0; i < times; ++i) {
+        Position next{curPos.row, curPos.col + shift};
+        if (!board->canPlace(*curBlock, next)) break;
+        curPos = next;
+        moved = true;
         
         // Level 3 and 4 heavy blocks: after horizontal move (left/right), automatically drop 1 row
-        if ((levelNum == 3 || levelNum == 4) && (dir == "left" || dir == "right")) {
-            Position heavyPos = curPos;
-            heavyPos.row++;
-            if (board->canPlace(*curBlock, heavyPos)) {
-                curPos = heavyPos;
-                notifyObservers();
-            }
+        if (levelHeavy && board->dropDistance(*curBlock, curPos) > 0) {
+            curPos.row++;
         }
         
         // Lock delay: if block was locked and player moved horizontally, check if still locked
-        if (isLocked && (dir == "left" || dir == "right")) {
+        if (isLocked) {
             setUsedLockDelayMove(true);
             // Check if block can still move down after horizontal move
             if (canMoveDown()) {
@@ -96,40 +125,45 @@ bool BasicPlayer::move(const std::string& dir) {
             }
         }
         
-        return true;
+        curPos.row += heavyRows();
     }
     
-    return false;
+    if (moved) {
+        publish(PieceMoved{from, curPos});
+        notifyChanges(Changes{});  // Notify observers once, with the final position
+    }
+    return moved;
 }
 
-void BasicPlayer::rotate(const std::string& dir) {
-    // Get bounding box before rotation
-    int oldMinRow, oldMaxRow, oldMinCol, oldMaxCol;
-    curBlock->getBoundingBox(oldMinRow, oldMaxRow, oldMinCol, oldMaxCol);
+int BasicPlayer::heavyRows() const {
+    if (heavyEffects == 0) return 0;
+    return std::min(2 * heavyEffects, board->dropDistance(*curBlock, curPos));
+}
+
+void BasicPlayer::rotate(Action dir) {
+    bool clockwise = (dir == Action::Clockwise);
+    Position from = curPos;
+    bool rotated = false;
+    
+    // Shift that preserves the lower-left corner of the bounding box
+    Position shift = curBlock->getRotationShift(clockwise);
     
     // Perform rotation
-    if (dir == "cw") curBlock->rotateCW();
+    if (clockwise) curBlock->rotateCW();
     else curBlock->rotateCCW();
-    
-    // Get bounding box after rotation
-    int newMinRow, newMaxRow, newMinCol, newMaxCol;
-    curBlock->getBoundingBox(newMinRow, newMaxRow, newMinCol, newMaxCol);
-    
-    // Adjust position to preserve lower-left corner of bounding box
-    curPos.row += (oldMaxRow - newMaxRow);
-    curPos.col += (oldMinCol - newMinCol);
+    curPos = curPos + shift;
     
     // Check if rotation is valid
     if (!board->canPlace(*curBlock, curPos)) {
         // Revert rotation
-        if (dir == "cw") curBlock->rotateCCW();
+        if (clockwise) curBlock->rotateCCW();
         else curBlock->rotateCW();
         
         // Restore position
-        curPos.row -= (oldMaxRow - newMaxRow);
-        curPos.col -= (oldMinCol - newMinCol);
+        curPos.row -= shift.row;
+        curPos.col -= shift.col;
     } else {
-        notifyObservers();  // Notify observers when block rotates
+        rotated = true;
         
         // Level 3 and 4 heavy blocks: after rotation, automatically drop 1 row
         if (levelNum == 3 || levelNum == 4) {
@@ -137,7 +171,6 @@ void BasicPlayer::rotate(const std::string& dir) {
             heavyPos.row++;
             if (board->canPlace(*curBlock, heavyPos)) {
                 curPos = heavyPos;
-                notifyObservers();
             }
         }
         
@@ -152,14 +185,36 @@ void BasicPlayer::rotate(const std::string& dir) {
             }
         }
     }
+    
+    // Heavy effects: the rotation's fall
+    curPos.row += heavyRows();
+    
+    // Publish and notify once, with the final position
+    if (rotated) publish(PieceRotated{clockwise, from, curPos});
+    else if (curPos != from) publish(PieceMoved{from, curPos});
+    if (rotated || curPos != from) notifyChanges(Changes{});
 }
 
 void BasicPlayer::drop() {
-    while (move("down")) {}
+    if (!curBlock) return;  // already dropped this turn
+    
+    // The turn ends with the drop, so observers see the board unblinded
+    if (effects & Blinded) {
+        board->setBlind(false);
+        markChanged(Changes{Changes::ALL_ROWS, 0});
+    }
+    
+    // Land directly on the column heights instead of stepping row by row
+    curPos.row += board->dropDistance(*curBlock, curPos);
     
     board->place(*curBlock, curPos);
+    publish(BlockPlaced{curBlock->getSymbol(), curPos});
     auto result = board->clearFullRowsWithBlockInfo();
     lastRowsCleared = result.rowsCleared;
+    if (result.rowsCleared > 0) {
+        publish(RowsCleared{result.rowsCleared});
+        markChanged(Changes{Changes::ALL_ROWS, 0});  // the rows above shifted down
+    }
     
     // Level 4: External constructive force
     // Every 5 blocks dropped without clearing at least one row, drop a 1x1 '*' block in center column
@@ -169,8 +224,13 @@ void BasicPlayer::drop() {
             // Drop 1x1 '*' block in center column
             if (blocksDroppedWithoutClear % 5 == 0) {
                 int centerCol = board->getCols() / 2;  // Center column (11 columns: 0-10, so 5 is center)
+                int height = board->getColumnHeight(centerCol);
                 board->drop(centerCol);
-                notifyObservers();
+                int row = board->getRows() - height - 1;
+                if (board->getColumnHeight(centerCol) > height) {
+                    publish(BlockPlaced{'*', Position{row, centerCol}});
+                }
+                markChanged(Changes{Changes::rowRange(row, row), 0});
             }
         } else {
             // Row was cleared, reset counter
@@ -178,130 +238,155 @@ void BasicPlayer::drop() {
         }
     }
     
+    if (int points = clearScore(levelNum, result)) {
+        score += points;
+        publish(ScoreChanged{score, points});
+        markChanged(Changes{0, Changes::Stats});
+    }
+    
+    canHold = true;  // Reset hold ability after drop
+    
+    // Clear current block - Game will spawn for the next player
+    curBlock.reset();
+    
+    // The block landed on rows drawn with its phantom
+    notifyChanges(Changes{});  // Notify observers when block is dropped
+}
+
+int BasicPlayer::clearScore(int level, const Board::ClearRowsResult& result) {
+    int points = 0;
+    
     // Line Clearing scoring: (current level + number of lines cleared)^2
     if (result.rowsCleared > 0) {
-        int lineClearingScore = (levelNum + result.rowsCleared) * (levelNum + result.rowsCleared);
-        score += lineClearingScore;
+        points += (level + result.rowsCleared) * (level + result.rowsCleared);
     }
     
     // Block Removal scoring: (born level + 1)^2 for each completely removed block
     for (int bornLevel : result.removedBlockBornLevels) {
-        int blockRemovalScore = (bornLevel + 1) * (bornLevel + 1);
-        score += blockRemovalScore;
+        points += (bornLevel + 1) * (bornLevel + 1);
     }
     
-    canHold = true;  // Reset hold ability after drop
-    
-    // Clear current block - Game will spawn for the next player
-    curBlock = nullptr;
-    
-    notifyObservers();  // Notify observers when block is dropped
+    return points;
 }
 
 void BasicPlayer::hold() {
     // Can only hold if in top row (below reserve rows = row 3) and haven't held yet this turn
-    if (curPos.row != 3 || !canHold) return;
+    if (!curBlock || curPos.row != 3 || !canHold) return;
     
+    markChanged(Changes{0, Changes::Held});
     if (!heldBlock) {
         // First time holding - store current and spawn next
         heldBlock = curBlock;
+        publish(PieceHeld{heldBlock->getSymbol(), 0, 0, curPos});
         spawnBlock();
     } else {
         // Swap current with held
-        std::shared_ptr<Block> temp = curBlock;
-        curBlock = heldBlock;
-        heldBlock = temp;
+        std::swap(curBlock, heldBlock);
         curPos = Position{3, 0};
         
         // Check if swapped block can be placed
         if (!board->canPlace(*curBlock, curPos)) {
             // Swap back if can't place
-            curBlock = heldBlock;
-            heldBlock = temp;
+            std::swap(curBlock, heldBlock);
             return;
         }
+        publish(PieceHeld{heldBlock->getSymbol(), curBlock->getSymbol(), curBlock->getRotation(), curPos});
     }
     
     canHold = false;  // Can only hold once per turn
-    notifyObservers();  // Notify observers when block is held
+    notifyChanges(Changes{});  // Notify observers when block is held
+}
+
+void BasicPlayer::selectLevel(int num) {
+    levelNum = num;
+    level = levels[num];
+}
+
+std::uint64_t BasicPlayer::overlayRows() const {
+    std::uint64_t rows = 0;
+    if (curBlock) {
+        // The current block, down to its phantom
+        const Orientation& o = curBlock->getOrientation();
+        rows |= Changes::rowRange(curPos.row + o.minRow,
+                                  curPos.row + board->dropDistance(*curBlock, curPos) + o.maxRow);
+    }
+    if (const Block* hint = getHintBlock()) {
+        const Orientation& o = hint->getOrientation();
+        rows |= Changes::rowRange(hintPos.row + o.minRow, hintPos.row + o.maxRow);
+    }
+    return rows;
+}
+
+void BasicPlayer::notifyChanges(Changes changes) {
+    if (hasObservers()) {
+        // Redraw the overlays where they were drawn last time and where they are now
+        std::uint64_t rows = overlayRows();
+        changes.rows |= overlayDrawn | rows;
+        overlayDrawn = rows;
+    }
+    notifyObservers(changes);
 }
 
 void BasicPlayer::levelUp() {
     if (levelNum < 4) {
-        ++levelNum;
-        if (levelNum == 0) {
-            level = std::make_shared<Level0>();
-        } else if (levelNum == 1) {
-            level = std::make_shared<Level1>();
-        } else if (levelNum == 2) {
-            level = std::make_shared<Level2>();
-        } else if (levelNum == 3) {
-            level = std::make_shared<Level3>();
-        } else if (levelNum == 4) {
-            level = std::make_shared<Level4>();
-        }
+        selectLevel(levelNum + 1);
+        markChanged(Changes{0, Changes::Stats});
+        publish(LevelChanged{levelNum});
         // Regenerate next block with new level
         if (!curBlock) {
             // If no current block spawned yet, regenerate next block
             generateNextBlock();
         }
-        notifyObservers();  // Notify observers when level changes
+        notifyChanges(Changes{});  // Notify observers when level changes
     }
 }
 
 void BasicPlayer::levelDown() {
     if (levelNum > 0) {
-        --levelNum;
-        if (levelNum == 0) {
-            level = std::make_shared<Level0>();
-            if (auto lvl0 = std::dynamic_pointer_cast<Level0>(level)) {
-                lvl0->setScriptFile(level0ScriptFile);
-            }
-        } else if (levelNum == 1) {
-            level = std::make_shared<Level1>();
-        } else if (levelNum == 2) {
-            level = std::make_shared<Level2>();
-        } else if (levelNum == 3) {
-            level = std::make_shared<Level3>();
-        }
+        selectLevel(levelNum - 1);
+        markChanged(Changes{0, Changes::Stats});
+        publish(LevelChanged{levelNum});
         // Regenerate next block with new level
         if (!curBlock) {
             generateNextBlock();
         }
-        notifyObservers();  // Notify observers when level changes
+        notifyChanges(Changes{});  // Notify observers when level changes
     }
 }
 
 void BasicPlayer::reset() {
+    publish(PlayerReset{});
+    if (score != 0) publish(ScoreChanged{0, 0});
+    if (levelNum != 0) publish(LevelChanged{0});
     board->reset();
     score = 0;
-    levelNum = 0;
-    // Create a new Level0 based on the currently saved script file.
-    level = std::make_shared<Level0>();
-    if (auto lvl0 = std::dynamic_pointer_cast<Level0>(level)) {
-        lvl0->setScriptFile(level0ScriptFile);
-    }
+    // Every level starts over (Level0 from the top of its current script)
+    for (auto& lvl : levels) lvl->restoreState(LevelState{});
+    selectLevel(0);
     blockIdCounter = 0;
     alive = true;
-    curBlock = nullptr;
-    heldBlock = nullptr;
+    curBlock.reset();
+    heldBlock.reset();
+    hintBlock.reset();
+    effects = 0;
+    heavyEffects = 0;
     canHold = true;
     lastRowsCleared = 0;
+    markChanged(Changes::all());
     generateNextBlock();
     // Don't spawn block yet - wait for player's turn
 }
 
 void BasicPlayer::setScriptFile(const std::string& filename) {
-    level0ScriptFile = filename;
-    if (levelNum == 0) {
-        if (auto lvl0 = std::dynamic_pointer_cast<Level0>(level)) {
-            lvl0->setScriptFile(level0ScriptFile);
-        }
-    }
+    levels[0]->setScriptFile(filename);
+}
+
+void BasicPlayer::seedRng(std::uint64_t seed, std::uint64_t stream) {
+    rng.seed(seed, stream);
 }
 
 bool BasicPlayer::hasCurrentBlock() const {
-    return curBlock != nullptr;
+    return curBlock.has_value();
 }
 
 bool BasicPlayer::canMoveDown() const {
@@ -311,6 +396,39 @@ bool BasicPlayer::canMoveDown() const {
     return board->canPlace(*curBlock, downPos);
 }
 
+// Zobrist key of a piece in one of the player's piece slots. The slot tag
+// sits above the board's cell keys (which use the low 16 bits) so the two
+// key ranges never collide.
+static std::uint64_t pieceKey(std::uint64_t slot, const Block& block, Position pos = Position{}) {
+    return zobristMix((slot << 56)
+                      | (static_cast<std::uint64_t>(static_cast<unsigned char>(block.getSymbol())) << 24)
+                      | (static_cast<std::uint64_t>(block.getRotation()) << 16)
+                      | (static_cast<std::uint64_t>(pos.row & 0xFF) << 8)
+                      | static_cast<std::uint64_t>(pos.col & 0xFF));
+}
+
+std::uint64_t BasicPlayer::getStateHash() const {
+    std::uint64_t hash = board->getHash();
+    if (curBlock) hash ^= pieceKey(1, *curBlock, curPos);
+    if (nextBlock) hash ^= pieceKey(2, *nextBlock);
+    if (heldBlock) hash ^= pieceKey(3, *heldBlock);
+    return hash;
+}
+
+void BasicPlayer::setHint(const Block& block, const Position& pos) {
+    hintBlock = block;
+    hintPos = pos;
+    hintHash = getStateHash();
+    notifyChanges(Changes{});  // Notify observers so the hint is drawn
+}
+
+const Block* BasicPlayer::getHintBlock() const {
+    // A hint only applies to the state it was computed for
+    return hintBlock && hintHash == getStateHash() ? &*hintBlock : nullptr;
+}
+
+Position BasicPlayer::getHintPos() const { return hintPos; }
+
 int BasicPlayer::getRowsCleared() const {
     return lastRowsCleared;
 }
@@ -335,17 +453,35 @@ void BasicPlayer::setUsedLockDelayMove(bool used) {
     lockDelayMoveUsed = used;
 }
 
-std::shared_ptr<Level> BasicPlayer::getLevelObject() const {
-    return level;
+void BasicPlayer::applyBlind() {
+    effects |= Blinded;
+    board->setBlind(true);  // the current turn is blinded too
+    publish(EffectApplied{EffectKind::Blind, 0});
+    notifyChanges(Changes{Changes::ALL_ROWS, 0});
+}
+
+void BasicPlayer::applyHeavy() {
+    ++heavyEffects;
+    publish(EffectApplied{EffectKind::Heavy, 0});
+}
+
+void BasicPlayer::applyForce(char blockType) {
+    publish(EffectApplied{EffectKind::Force, blockType});
+    if (curBlock) {
+        replaceCurrentBlock(blockType);
+    } else if (!(effects & ForcePending)) {
+        // No block in play: force the next spawn (the first force played wins)
+        forcedType = blockType;
+        effects |= ForcePending;
+    }
 }
 
-int BasicPlayer::getNextBlockId() const {
-    return blockIdCounter + 1;  // Next block ID that will be used
+bool BasicPlayer::hasBlindEffect() const {
+    return effects & Blinded;
 }
 
-void BasicPlayer::setNextBlock(std::shared_ptr<Block> block) {
-    nextBlock = block;
-    notifyObservers();  // Notify observers when next block changes
+int BasicPlayer::getHeavyEffects() const {
+    return heavyEffects;
 }
 
 bool BasicPlayer::replaceCurrentBlock(char blockType) {
@@ -354,48 +490,84 @@ bool BasicPlayer::replaceCurrentBlock(char blockType) {
         return false;
     }
     
-    // Create the new block with the same ID and level
-    int blockId = curBlock->getId();
-    int levelNum = getLevel();
-    std::shared_ptr<Block> newBlock;
-    
-    if (blockType == 'I') {
-        newBlock = std::make_shared<IBlock>(blockId, levelNum);
-    } else if (blockType == 'J') {
-        newBlock = std::make_shared<JBlock>(blockId, levelNum);
-    } else if (blockType == 'L') {
-        newBlock = std::make_shared<LBlock>(blockId, levelNum);
-    } else if (blockType == 'O') {
-        newBlock = std::make_shared<OBlock>(blockId, levelNum);
-    } else if (blockType == 'S') {
-        newBlock = std::make_shared<SBlock>(blockId, levelNum);
-    } else if (blockType == 'T') {
-        newBlock = std::make_shared<TBlock>(blockId, levelNum);
-    } else if (blockType == 'Z') {
-        newBlock = std::make_shared<ZBlock>(blockId, levelNum);
-    } else {
-        // Invalid block type
+    // Only the seven block types can be forced
+    if (blockType != 'I' && blockType != 'J' && blockType != 'L' && blockType != 'O' &&
+        blockType != 'S' && blockType != 'T' && blockType != 'Z') {
         return false;
     }
     
+    // Create the new block with the same ID and level
+    Block newBlock{curBlock->getId(), blockType, getLevel()};
+    
     // Place new block at initial position (row 3, col 0)
     Position initialPos{3, 0};
     
     // Check if the new block can be placed at initial position
-    if (!board->canPlace(*newBlock, initialPos)) {
+    if (!board->canPlace(newBlock, initialPos)) {
         // Cannot place - player loses
         alive = false;
-        curBlock = nullptr;
-        notifyObservers();
+        curBlock.reset();
+        publish(PlayerLost{});
+        notifyChanges(Changes{});
         return false;
     }
     
     // Replace current block
     curBlock = newBlock;
     curPos = initialPos;
-    notifyObservers();
+    publish(PieceReplaced{blockType, curPos});
+    notifyChanges(Changes{});
     return true;
 }
 
+PlayerSnapshot BasicPlayer::snapshot() const {
+    PlayerSnapshot snap;
+    snap.board = *board;
+    snap.curBlock = curBlock;
+    snap.nextBlock = nextBlock;
+    snap.heldBlock = heldBlock;
+    snap.curPos = curPos;
+    snap.levelState = level->saveState();
+    snap.rng = rng;
+    snap.score = score;
+    snap.levelNum = levelNum;
+    snap.blockIdCounter = blockIdCounter;
+    snap.lastRowsCleared = lastRowsCleared;
+    snap.blocksDroppedWithoutClear = blocksDroppedWithoutClear;
+    snap.alive = alive;
+    snap.canHold = canHold;
+    snap.isLocked = isLocked;
+    snap.lockDelayMoveUsed = lockDelayMoveUsed;
+    snap.effects = effects;
+    snap.heavyEffects = heavyEffects;
+    snap.forcedType = forcedType;
+    return snap;
+}
+
+void BasicPlayer::restore(const PlayerSnapshot& snap) {
+    *board = snap.board;
+    curBlock = snap.curBlock;
+    nextBlock = snap.nextBlock;
+    heldBlock = snap.heldBlock;
+    curPos = snap.curPos;
+    
+    selectLevel(snap.levelNum);
+    level->restoreState(snap.levelState);
+    rng = snap.rng;
+    
+    score = snap.score;
+    blockIdCounter = snap.blockIdCounter;
+    lastRowsCleared = snap.lastRowsCleared;
+    blocksDroppedWithoutClear = snap.blocksDroppedWithoutClear;
+    alive = snap.alive;
+    canHold = snap.canHold;
+    isLocked = snap.isLocked;
+    lockDelayMoveUsed = snap.lockDelayMoveUsed;
+    effects = snap.effects;
+    heavyEffects = snap.heavyEffects;
+    forcedType = snap.forcedType;
+    markChanged(Changes::all());  // drawn in full by the next notification
+}
+
 BasicPlayer::~BasicPlayer() {}
 
@@ -1,13 +1,54 @@
 // BasicPlayer module - interface
 export module basicplayer;
 
+import <array>;
+import <cstdint>;
 import <memory>;
+import <optional>;
 import <string>;
+import action;
 import player;
 import board;
 import block;
 import level;
 import position;
+import rng;
+import subject;
+
+/*
+ * PlayerSnapshot
+ *
+ * Plain-value copy of one player's full game state, used to fork positions
+ * while searching. It is trivially copyable, so forking a snapshot is a
+ * single memcpy: the board and blocks are held by value, the level as
+ * its number plus its LevelState, and the block generator by value, so a
+ * restored player draws the same blocks again. The special effects played
+ * on the player (blind, heavy, a pending force) are captured too.
+ *
+ * Not captured: the Level 0 script file (the snapshot keeps only the cursor
+ * into it), and the state of the levels other than the current one.
+ */
+export struct PlayerSnapshot {
+    Board board;
+    std::optional<Block> curBlock;
+    std::optional<Block> nextBlock;
+    std::optional<Block> heldBlock;
+    Position curPos;
+    LevelState levelState;
+    Rng rng;
+    int score = 0;
+    int levelNum = 0;
+    int blockIdCounter = 0;
+    int lastRowsCleared = 0;
+    int blocksDroppedWithoutClear = 0;
+    bool alive = true;
+    bool canHold = true;
+    bool isLocked = false;
+    bool lockDelayMoveUsed = false;
+    std::uint8_t effects = 0;
+    int heavyEffects = 0;
+    char forcedType = 0;
+};
 
 /*
  * BasicPlayer
@@ -19,9 +60,7 @@ import position;
  *   - player score and level
  *   - movement, rotation, dropping, holding
  *   - level changes and scriptfile handling (for Level 0)
- *
- * Effects (blind / heavy / force) are handled through decorators,
- * so BasicPlayer only contains base game logic.
+ *   - the special effects (blind / heavy / force) played on this player
  */
 export class BasicPlayer : public Player {
 public:
@@ -33,20 +72,23 @@ public:
     int getScore() const override;
     int getLevel() const override;          // current level number
     bool isAlive() const override;
-    std::shared_ptr<Block> getCurBlock() override;
-    std::shared_ptr<Block> getNextBlock() override;
-    std::shared_ptr<Block> getHeldBlock() override;
+    const Block* getCurBlock() const override;
+    const Block* getNextBlock() const override;
+    const Block* getHeldBlock() const override;
     Position getCurPos() const override;    // current origin of the falling block
     
     // === Block operations ===
     void generateNextBlock() override;      // asks level to generate a new nextBlock
     bool spawnBlock() override;             // moves nextBlock → curBlock; returns false if game over
-    bool move(const std::string& dir) override;   // left / right / down
-    void rotate(const std::string& dir) override; // cw / ccw
+    bool move(Action dir, int times = 1) override;  // left / right / down, `times` steps
+    void rotate(Action dir) override;       // cw / ccw
     void drop() override;                   // hard drop; updates scoring
     
     // Hold mechanic (only allowed once per turn)
     void hold() override;
+    
+    // Testing commands and force: swap in a block of another type
+    bool replaceCurrentBlock(char blockType) override;
 
     // === Level operations ===
     void levelUp() override;
@@ -55,35 +97,85 @@ public:
     // === Game operations ===
     void reset() override;                  // full game reset
     void setScriptFile(const std::string& filename) override; // for Level 0 only
+    void seedRng(std::uint64_t seed, std::uint64_t stream) override;
     
     // === Utility ===
-    bool hasCurrentBlock() const override;  // true if curBlock != nullptr
+    bool hasCurrentBlock() const override;  // true if there is a current block
     bool canMoveDown() const override;      // checks if current block can drop 1 row
+    std::uint64_t getStateHash() const override; // board hash extended with the piece state
+    
+    // === Hint overlay ===
+    void setHint(const Block& block, const Position& pos) override; // notifies observers
+    const Block* getHintBlock() const override;
+    Position getHintPos() const override;
+    
+    // === Special effects ===
+    void applyBlind() override;             // hides the board right away
+    void applyHeavy() override;
+    void applyForce(char blockType) override;
+    bool hasBlindEffect() const override;
+    int getHeavyEffects() const override;
     
     // Information for applying special effects
     int getRowsCleared() const;             // last # rows cleared by drop()
     bool canApplySpecial() const;           // true if cleared ≥ 2 rows
     
+    // Points scored for the rows (and the blocks removed with them) that one
+    // drop cleared at the given level
+    static int clearScore(int level, const Board::ClearRowsResult& result);
+    
     // Lock delay state (for formal Tetris behavior)
     bool isBlockLocked() const;             // true if block has touched ground and is in lock delay
     bool hasUsedLockDelayMove() const;      // true if player has used the one allowed move after touching ground
     void setLocked(bool locked);            // set lock state (used internally)
     void setUsedLockDelayMove(bool used);   // set lock delay move state (used internally)
     
-    // Helpers used by decorator effects
-    std::shared_ptr<Level> getLevelObject() const override;
-    int getNextBlockId() const override;
-    void setNextBlock(std::shared_ptr<Block> block) override; // used by ForceEffect
-    bool replaceCurrentBlock(char blockType) override; // used by ForceEffect
+    // Snapshots for search: copy the full state out, or load it back in.
+    // restore() does not notify observers or publish events; the caller
+    // decides whether the restored state should be displayed, and event
+    // consumers must re-read the player after one.
+    PlayerSnapshot snapshot() const;
+    void restore(const PlayerSnapshot& snap);
     
 private:
+    // Bits of `effects`
+    enum EffectFlag : std::uint8_t {
+        Blinded = 1 << 0,       // blind is active
+        ForcePending = 1 << 1,  // the next spawn is forced to forcedType
+    };
+    std::uint8_t effects = 0;               // active EffectFlag bits
+    int heavyEffects = 0;                   // heavy effects played (each adds 2 rows of fall)
+    char forcedType = 0;                    // block type of a pending force
+    
+    // Heavy effects: rows the current block falls after a move or rotation
+    // (2 per heavy effect, stopping where the block lands)
+    int heavyRows() const;
+
     int lastRowsCleared = 0;                // tracks how many rows were cleared last drop
     int blocksDroppedWithoutClear = 0;      // Level 4: tracks blocks dropped without clearing rows
     bool isLocked = false;                  // true if block has touched ground and is waiting for lock delay
     bool lockDelayMoveUsed = false;         // true if player has used the one allowed move after touching ground
-    std::string level0ScriptFile = "sequence.txt";  
-    // Stores the currently active script file for Level0.
-    // When scriptfile is changed during the game, this keeps the new path so that:
-    //   - Level0 uses the latest script file
-    //   - When player resets or levels down from L1+ → L0, the same script is used
+    std::optional<Block> hintBlock;         // last suggested placement (display only, not in snapshots)
+    Position hintPos;
+    std::uint64_t hintHash = 0;             // getStateHash() when the hint was set
+    std::array<std::shared_ptr<Level>, 5> levels;
+    // All five levels, created once and kept for the player's lifetime, so a
+    // level change only selects another one:
+    //   - each level keeps its state (Level0's script and cursor, the random
+    //     levels' lookahead) while another level is current
+    //   - a new script file goes straight to Level0, whatever the current level
+    //   - reset() puts every level back into its initial state
+
+    // Makes levels[num] the current level (no allocation, no I/O)
+    void selectLevel(int num);
+    
+    // Board rows drawn over the board's cells: the current block down to
+    // its phantom, and the hint
+    std::uint64_t overlayRows() const;
+    std::uint64_t overlayDrawn = 0;         // overlayRows() at the last notification
+    
+    // Notifies the observers of changes plus the overlay rows, both where
+    // the overlays were last drawn and where they are now, so the moves in
+    // between need not be tracked
+    void notifyChanges(Changes changes);
 };
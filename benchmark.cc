@@ -0,0 +1,537 @@
+/**
+ * @file benchmark.cc
+ * @brief Throughput benchmark for the game engine (no display, no X11)
+ *
+ * Measures the hot Board operations used on every turn so engine changes
+ * can be compared before and after:
+ * - canPlace: collision tests of every piece/rotation over a cluttered board
+ * - place + clear: filling four rows with vertical I-blocks and clearing them
+ * - drop clear: one placement followed by a clear that finds no full row
+ * - rotate: a rotation plus the bounding-box reads BasicPlayer::rotate needs
+ * - hard drop: landing distance of every piece/rotation from the top row
+ * - fork: copying a PlayerSnapshot, and a snapshot()/restore() round trip
+ * - canPlace and place + clear again on a wide 18x64 variant board
+ * - spawn + drop: steady-state BasicPlayer turns, counting heap allocations
+ *   (the benchmark exits with status 1 if any turn allocates)
+ * - move generation: all reachable placements of every piece on a cluttered board
+ * - hint: move generation plus evaluating every placement
+ * - vecenv step: random actions in 64 lockstep games, counting heap allocations
+ * - reset: BasicPlayer::reset() at level 0 (every resident level restarts in place)
+ * - generate: Level 3 block types drawn from the lookahead queue
+ * - level change: levelUp() to 4 and levelDown() to 0 with a block in play
+ * - moves after specials: left/right through Game with 0 and 100 blinds played
+ * - multiplied moves: 100left/100right through Game (one call each)
+ * - renders per command: observer notifications per command, without and with batching,
+ *   and the typed events published per command
+ * - parse command: abbreviated command words resolved to Commands, counting heap allocations
+ *
+ * It also prints the memory footprint of one Board.
+ *
+ * Usage: ./benchmark [iterations]
+ */
+
+import <iostream>;
+import <string>;
+import <vector>;
+import <memory>;
+import <chrono>;
+import <type_traits>;
+import <new>;
+import <cstdlib>;
+import <cstdint>;
+import <variant>;
+import board;
+import basicplayer;
+import movegen;
+import hint;
+import vecenv;
+import action;
+import game;
+import commandinterpreter;
+import observer;
+import subject;
+import level3;
+import rng;
+import block;
+import iblock;
+import jblock;
+import lblock;
+import oblock;
+import sblock;
+import tblock;
+import zblock;
+import position;
+
+using namespace std;
+
+// Prevents the optimizer from discarding benchmark results
+static volatile long long sink = 0;
+
+// Every heap allocation in the process goes through these replacements
+static long long allocationCount = 0;
+
+void* operator new(std::size_t size) {
+    ++allocationCount;
+    if (void* p = std::malloc(size ? size : 1)) return p;
+    throw std::bad_alloc{};
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+
+static double secondsSince(chrono::steady_clock::time_point start) {
+    return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+static void report(const string& name, long long ops, double seconds) {
+    cout << name << ": " << ops << " ops in " << seconds << " s ("
+         << static_cast<long long>(ops / seconds) << " ops/s)" << endl;
+}
+
+// Every piece in every rotation state
+static vector<shared_ptr<Block>> allOrientations() {
+    vector<shared_ptr<Block>> pieces;
+    for (int rot = 0; rot < 4; ++rot) {
+        vector<shared_ptr<Block>> fresh = {
+            make_shared<IBlock>(0, 0), make_shared<JBlock>(0, 0), make_shared<LBlock>(0, 0),
+            make_shared<OBlock>(0, 0), make_shared<SBlock>(0, 0), make_shared<TBlock>(0, 0),
+            make_shared<ZBlock>(0, 0)
+        };
+        for (auto& b : fresh) {
+            for (int i = 0; i < rot; ++i) b->rotateCW();
+            pieces.push_back(b);
+        }
+    }
+    return pieces;
+}
+
+// A bottom-heavy board with ragged columns and some holes
+template <typename BoardType>
+static void clutter(BoardType& board) {
+    for (int c = 0; c < board.getCols(); ++c) {
+        int height = 3 + (c * 7) % 9;
+        for (int i = 0; i < height; ++i) {
+            if ((c + i) % 5 != 0) board.drop(c);
+        }
+    }
+}
+
+template <typename BoardType>
+static void benchCanPlace(const string& name, long long iterations) {
+    BoardType board;
+    clutter(board);
+    auto pieces = allOrientations();
+
+    long long ops = 0;
+    long long hits = 0;
+    auto start = chrono::steady_clock::now();
+    for (long long it = 0; it < iterations; ++it) {
+        for (const auto& piece : pieces) {
+            for (int r = 0; r < board.getRows(); ++r) {
+                for (int c = 0; c < board.getCols(); ++c) {
+                    hits += board.canPlace(*piece, Position{r, c});
+                    ++ops;
+                }
+            }
+        }
+    }
+    double elapsed = secondsSince(start);
+    sink = sink + hits;
+    report(name, ops, elapsed);
+}
+
+template <typename BoardType>
+static void benchPlaceAndClear(const string& name, long long iterations) {
+    BoardType board;
+    IBlock vertical{0, 0};
+    vertical.rotateCW();
+
+    long long rows = 0;
+    auto start = chrono::steady_clock::now();
+    for (long long it = 0; it < iterations; ++it) {
+        for (int c = 0; c < board.getCols(); ++c) {
+            board.place(vertical, Position{board.getRows() - 1, c});
+        }
+        auto result = board.clearFullRowsWithBlockInfo();
+        rows += result.rowsCleared + static_cast<long long>(result.removedBlockBornLevels.size());
+    }
+    double elapsed = secondsSince(start);
+    sink = sink + rows;
+    report(name, iterations, elapsed);
+}
+
+static void benchDropClear(long long iterations) {
+    Board board;
+    clutter(board);
+    TBlock piece{0, 0};
+
+    long long rows = 0;
+    auto start = chrono::steady_clock::now();
+    for (long long it = 0; it < iterations; ++it) {
+        board.place(piece, Position{0, 0});
+        rows += board.clearFullRowsWithBlockInfo().rowsCleared;
+        board.remove(piece, Position{0, 0});
+    }
+    double elapsed = secondsSince(start);
+    sink = sink + rows;
+    report("place + clear (no full row)", iterations, elapsed);
+}
+
+static void benchRotate(long long iterations) {
+    auto pieces = allOrientations();
+
+    long long acc = 0;
+    auto start = chrono::steady_clock::now();
+    for (long long it = 0; it < iterations; ++it) {
+        for (const auto& piece : pieces) {
+            int minRow, maxRow, minCol, maxCol;
+            piece->getBoundingBox(minRow, maxRow, minCol, maxCol);
+            piece->rotateCW();
+            int newMinRow, newMaxRow, newMinCol, newMaxCol;
+            piece->getBoundingBox(newMinRow, newMaxRow, newMinCol, newMaxCol);
+            acc += (maxRow - newMaxRow) + (minCol - newMinCol);
+        }
+    }
+    double elapsed = secondsSince(start);
+    sink = sink + acc;
+    report("rotate", iterations * static_cast<long long>(pieces.size()), elapsed);
+}
+
+static void benchHardDrop(long long iterations) {
+    Board board;
+    clutter(board);
+    auto pieces = allOrientations();
+
+    long long ops = 0;
+    long long rows = 0;
+    auto start = chrono::steady_clock::now();
+    for (long long it = 0; it < iterations; ++it) {
+        for (const auto& piece : pieces) {
+            for (int c = 0; c < board.getCols(); ++c) {
+                Position pos{3, c};
+                if (!board.canPlace(*piece, pos)) continue;
+                rows += board.dropDistance(*piece, pos);
+                ++ops;
+            }
+        }
+    }
+    double elapsed = secondsSince(start);
+    sink = sink + rows;
+    report("hard drop", ops, elapsed);
+}
+
+static void benchFork(long long iterations) {
+    static_assert(is_trivially_copyable_v<PlayerSnapshot>, "forking must be a memcpy");
+
+    BasicPlayer player;
+    player.reset();
+    player.spawnBlock();
+    clutter(*player.getBoard());
+    const PlayerSnapshot snap = player.snapshot();
+
+    // Rotating buffer so every copy lands in memory that is read back
+    vector<PlayerSnapshot> forks(64);
+    long long acc = 0;
+    auto start = chrono::steady_clock::now();
+    for (long long it = 0; it < iterations; ++it) {
+        PlayerSnapshot& fork = forks[it % forks.size()];
+        fork = snap;
+        fork.score += static_cast<int>(it);
+        acc += fork.score;
+    }
+    double elapsed = secondsSince(start);
+    sink = sink + acc;
+    report("fork (" + to_string(sizeof(PlayerSnapshot)) + "-byte snapshot copy)", iterations, elapsed);
+
+    start = chrono::steady_clock::now();
+    for (long long it = 0; it < iterations / 10; ++it) {
+        player.restore(snap);
+        acc += player.snapshot().score;
+    }
+    elapsed = secondsSince(start);
+    sink = sink + acc;
+    report("snapshot + restore", iterations / 10, elapsed);
+}
+
+// Returns false if a steady-state turn allocated
+static bool benchSpawnDrop(long long blocks) {
+    BasicPlayer player;
+    player.reset();
+    player.levelUp();  // random generation (every level is resident, so no allocation)
+
+    long long before = allocationCount;
+    auto start = chrono::steady_clock::now();
+    for (long long it = 0; it < blocks; ++it) {
+        if (player.spawnBlock()) {
+            player.drop();
+        } else {
+            player.getBoard()->reset();  // topped out: keep playing on an empty board
+        }
+    }
+    double elapsed = secondsSince(start);
+    long long allocations = allocationCount - before;
+    report("spawn + drop", blocks, elapsed);
+    cout << "heap allocations per spawned block: "
+         << static_cast<double>(allocations) / blocks << " (" << allocations << " total)" << endl;
+    if (allocations != 0) {
+        cerr << "FAIL: spawn + drop allocated " << allocations << " times (expected 0)" << endl;
+        return false;
+    }
+    return true;
+}
+
+static void benchMoveGen(long long iterations) {
+    Board board;
+    clutter(board);
+    MoveGenerator generator;
+    vector<Block> pieces;
+    for (char sym : string{"IJLOSTZ"}) pieces.push_back(Block{0, sym, 0});
+
+    long long calls = 0;
+    long long placements = 0;
+    auto start = chrono::steady_clock::now();
+    for (long long it = 0; it < iterations; ++it) {
+        for (const auto& piece : pieces) {
+            placements += generator.generate(board, piece, Position{3, 0}, MoveRules{3, 1}).size();
+            ++calls;
+        }
+    }
+    double elapsed = secondsSince(start);
+    sink = sink + placements;
+    report("move generation (level 3, heavy)", calls, elapsed);
+    cout << "placements per piece: " << static_cast<double>(placements) / calls << endl;
+}
+
+static void benchHint(long long iterations) {
+    BasicPlayer player;
+    player.reset();
+    player.spawnBlock();
+    clutter(*player.getBoard());
+    HintFinder finder;
+    WeightedHeuristic heuristic;
+
+    double best = 0;
+    auto start = chrono::steady_clock::now();
+    for (long long it = 0; it < iterations; ++it) {
+        if (auto hint = finder.find(player, heuristic)) best += hint->value;
+    }
+    double elapsed = secondsSince(start);
+    sink = sink + static_cast<long long>(best);
+    report("hint (generate + evaluate every placement)", iterations, elapsed);
+    cout << "hint latency: " << elapsed / iterations * 1e6 << " us" << endl;
+}
+
+static void benchVecEnv(long long steps) {
+    VecEnv env(64);
+    vector<uint8_t> observations(env.size() * VecEnv::OBSERVATION_SIZE);
+    vector<float> rewards(env.size());
+    vector<uint8_t> done(env.size());
+    vector<Action> actions(env.size());
+    env.reset(observations);
+
+    // Random policy from a fixed LCG, biased towards moves so games last
+    unsigned int state = 12345;
+    long long episodes = 0;
+    long long before = allocationCount;
+    auto start = chrono::steady_clock::now();
+    for (long long it = 0; it < steps; ++it) {
+        for (auto& action : actions) {
+            state = state * 1103515245u + 12345u;
+            int pick = (state >> 16) % 8;
+            action = pick < 5 ? static_cast<Action>(pick) : Action::Drop;
+        }
+        env.step(actions, observations, rewards, done);
+        for (int i = 0; i < env.size(); ++i) episodes += done[i];
+    }
+    double elapsed = secondsSince(start);
+    long long allocations = allocationCount - before;
+    sink = sink + observations[0] + episodes;
+    report("vecenv step (64 envs)", steps * env.size(), elapsed);
+    cout << "episodes finished: " << episodes << ", heap allocations per env step: "
+         << static_cast<double>(allocations) / (steps * env.size()) << endl;
+}
+
+static void benchReset(long long iterations) {
+    BasicPlayer player;
+    player.setScriptFile("biquadris_sequence1.txt");
+
+    long long acc = 0;
+    auto start = chrono::steady_clock::now();
+    for (long long it = 0; it < iterations; ++it) {
+        player.reset();
+        acc += player.getNextBlock()->getSymbol();
+    }
+    double elapsed = secondsSince(start);
+    sink = sink + acc;
+    report("reset (level 0)", iterations, elapsed);
+}
+
+// Level 3 block types drawn through the lookahead queue
+static void benchGenerate(long long blocks) {
+    Level3 level;
+    Rng rng{1, 1};
+
+    long long acc = 0;
+    auto start = chrono::steady_clock::now();
+    for (long long i = 0; i < blocks; ++i) acc += level.generateBlock(rng);
+    double elapsed = secondsSince(start);
+    sink = sink + acc;
+    report("generate block type (level 3)", blocks, elapsed);
+}
+
+// Bouncing between levels 0 and 4, as automated play does
+static void benchLevelChange(long long rounds) {
+    BasicPlayer player;
+    player.setScriptFile("biquadris_sequence1.txt");
+    player.reset();
+    player.spawnBlock();
+
+    long long acc = 0;
+    long long before = allocationCount;
+    auto start = chrono::steady_clock::now();
+    for (long long i = 0; i < rounds; ++i) {
+        for (int l = 0; l < 4; ++l) player.levelUp();
+        acc += player.getLevel();
+        for (int l = 0; l < 4; ++l) player.levelDown();
+    }
+    double elapsed = secondsSince(start);
+    long long allocations = allocationCount - before;
+    sink = sink + acc;
+    report("level change", rounds * 8, elapsed);
+    cout << "heap allocations per level change: "
+         << static_cast<double>(allocations) / (rounds * 8) << endl;
+}
+
+// Moves through Game::handleCommand after `specials` blind effects were
+// played on the player (blind leaves movement unchanged)
+static void benchMovesAfterSpecials(int specials, long long moves) {
+    Game game;
+    game.getPlayer1()->setScriptFile("biquadris_sequence1.txt");
+    game.restart();
+    for (int i = 0; i < specials; ++i) game.applySpecialEffect("blind", 1);
+
+    auto start = chrono::steady_clock::now();
+    for (long long i = 0; i < moves; ++i) game.handleCommand(i % 2 ? Action::Left : Action::Right);
+    double elapsed = secondsSince(start);
+    sink = sink + game.getPlayer1()->getCurPos().col;
+    report("move after " + to_string(specials) + " specials", moves, elapsed);
+}
+
+// Multiplied moves through Game: each command crosses the board and stops
+// at the wall, however large the multiplier
+static void benchMultipliedMoves(long long moves) {
+    Game game;
+    game.getPlayer1()->setScriptFile("biquadris_sequence1.txt");
+    game.restart();
+
+    auto start = chrono::steady_clock::now();
+    for (long long i = 0; i < moves; ++i) {
+        game.handleCommand(i % 2 ? Action::Left : Action::Right, 100);
+    }
+    double elapsed = secondsSince(start);
+    sink = sink + game.getPlayer1()->getCurPos().col;
+    report("100x move", moves, elapsed);
+}
+
+// Counts the frames a display would render, and the events a stats
+// collector would receive
+struct CountingObserver : Observer {
+    long long renders = 0;
+    long long events = 0;
+    long long rowsCleared = 0;
+    void notify() override { ++renders; }
+    void onEvent(const Event& event) override {
+        ++events;
+        if (auto cleared = get_if<RowsCleared>(&event)) rowsCleared += cleared->rows;
+    }
+};
+
+// Plays bot turns through Game the way main.cc does (one command at a time),
+// and counts the renders of an observer attached to both players
+static void benchRendersPerCommand(long long turns, bool batched) {
+    Game game;
+    CountingObserver display;
+    game.getPlayer1()->attach(&display);
+    game.getPlayer2()->attach(&display);
+    game.getPlayer1()->setScriptFile("biquadris_sequence1.txt");
+    game.getPlayer2()->setScriptFile("biquadris_sequence2.txt");
+    game.restart();
+
+    HintFinder finder;
+    WeightedHeuristic heuristic;
+    long long commands = 0;
+    display.renders = 0;
+    for (long long t = 0; t < turns; ++t) {
+        if (game.isGameOver()) {
+            NotificationBatch frame{game.getPlayer1().get(), game.getPlayer2().get()};
+            if (!batched) frame.finish();
+            game.restart();
+            ++commands;
+        }
+        auto hint = finder.find(*game.getCurrentPlayer(), heuristic);
+        if (!hint) break;
+        for (Action action : hint->commands) {
+            NotificationBatch frame{game.getPlayer1().get(), game.getPlayer2().get()};
+            if (!batched) frame.finish();  // no batch: every notification renders
+            bool dropped = false;
+            game.handleCommand(action, 1, nullptr, &dropped);
+            if (dropped) {
+                game.switchTurn();
+                game.getCurrentPlayer()->spawnBlock();
+            }
+            ++commands;
+        }
+    }
+    cout << "renders per command (" << (batched ? "batched" : "unbatched") << "): "
+         << static_cast<double>(display.renders) / commands << ", events per command: "
+         << static_cast<double>(display.events) / commands << " (" << display.rowsCleared
+         << " rows cleared)" << endl;
+}
+
+// Resolves a mix of full and abbreviated command words, as a script sends them
+static void benchParseCommand(long long iterations) {
+    const string words[] = {"left", "ri", "do", "cl", "cc", "dr", "lev", "levelu", "c", "hint"};
+    long long acc = 0;
+    long long allocations = allocationCount;
+    auto start = chrono::steady_clock::now();
+    for (long long i = 0; i < iterations; ++i) {
+        acc += static_cast<int>(CommandInterpreter::parseCommand(words[i % 10]).type);
+    }
+    double elapsed = secondsSince(start);
+    allocations = allocationCount - allocations;
+    sink = sink + acc;
+    report("parse command", iterations, elapsed);
+    cout << "heap allocations per parse: " << static_cast<double>(allocations) / iterations << endl;
+}
+
+int main(int argc, char* argv[]) {
+    long long iterations = 200000;
+    if (argc > 1) iterations = stoll(argv[1]);
+
+    cout << "sizeof(Board): " << sizeof(Board) << " bytes" << endl;
+
+    benchCanPlace<Board>("canPlace", iterations / 100);
+    benchPlaceAndClear<Board>("place x11 + clear 4 rows", iterations);
+    benchDropClear(iterations * 10);
+    benchRotate(iterations * 10);
+    benchHardDrop(iterations / 10);
+    benchFork(iterations * 10);
+    bool noAllocations = benchSpawnDrop(iterations);
+    benchMoveGen(iterations / 100);
+    benchHint(iterations / 100);
+    benchVecEnv(iterations / 100);
+    benchReset(iterations / 10);
+    benchGenerate(iterations * 50);
+    benchLevelChange(iterations);
+    benchMovesAfterSpecials(0, iterations * 5);
+    benchMovesAfterSpecials(100, iterations * 5);
+    benchMultipliedMoves(iterations * 5);
+    benchParseCommand(iterations * 50);
+    benchRendersPerCommand(iterations / 1000, false);
+    benchRendersPerCommand(iterations / 1000, true);
+
+    // Wide variant board: same code paths with 64-bit row masks
+    benchCanPlace<BasicBoard<18, 64>>("canPlace (18x64)", iterations / 500);
+    benchPlaceAndClear<BasicBoard<18, 64>>("place x64 + clear 4 rows (18x64)", iterations / 5);
+    return noAllocations ? 0 : 1;
+}
@@ -1,32 +1,45 @@
 // Block module - implementation
 module block;
 
-import <vector>;
-import <limits>;
+import <array>;
+import <cstdint>;
 import position;
 
-Block::Block(int id, char sym, int level) : id{id}, symbol{sym}, bornLevel{level} {}
+// Maps a symbol to its index in SHAPES; unknown symbols become an I-block
+static std::uint8_t shapeIndex(char sym) {
+    for (std::uint8_t i = 0; i < SHAPES.size(); ++i) {
+        if (SHAPES[i].symbol == sym) return i;
+    }
+    return 0;
+}
+
+Block::Block(int id, char sym, int level)
+    : id{id}, shape{shapeIndex(sym)}, bornLevel{static_cast<std::uint8_t>(level)} {}
 
 int Block::getId() const { return id; }
-char Block::getSymbol() const { return symbol; }
+char Block::getSymbol() const { return SHAPES[shape].symbol; }
 int Block::getBornLevel() const { return bornLevel; }
-const std::vector<Position>& Block::getCells() const { return cells; }
-Position Block::getOrigin() const { return origin; }
+int Block::getRotation() const { return rotation; }
+int Block::getRotationCount() const { return SHAPES[shape].rotationCount; }
+const std::array<Position, 4>& Block::getCells() const { return getOrientation().cells; }
 
 void Block::getBoundingBox(int& minRow, int& maxRow, int& minCol, int& maxCol) const {
-    minRow = std::numeric_limits<int>::max();
-    maxRow = std::numeric_limits<int>::min();
-    minCol = std::numeric_limits<int>::max();
-    maxCol = std::numeric_limits<int>::min();
-    
-    for (const auto& cell : cells) {
-        minRow = std::min(minRow, cell.row);
-        maxRow = std::max(maxRow, cell.row);
-        minCol = std::min(minCol, cell.col);
-        maxCol = std::max(maxCol, cell.col);
-    }
+    const Orientation& o = getOrientation();
+    minRow = o.minRow;
+    maxRow = o.maxRow;
+    minCol = o.minCol;
+    maxCol = o.maxCol;
 }
 
-void Block::setOrigin(const Position& pos) { origin = pos; }
+Position Block::getRotationShift(bool clockwise) const {
+    return clockwise ? getOrientation().cwShift : getOrientation().ccwShift;
+}
 
+void Block::rotateCW() {
+    rotation = static_cast<std::uint8_t>((rotation + 1) % SHAPES[shape].rotationCount);
+}
 
+void Block::rotateCCW() {
+    int count = SHAPES[shape].rotationCount;
+    rotation = static_cast<std::uint8_t>((rotation + count - 1) % count);
+}
@@ -1,123 +1,243 @@
 /**
  * @file block.cc
- * @brief Interface for the Block class (abstract block interface)
- * 
- * This file defines the abstract Block class, which represents a Tetris block
+ * @brief Interface for the Block class (block value type and shape tables)
+ *
+ * This file defines the Block class, which represents a Tetris block
  * (tetromino) in Biquadris. Each block consists of 4 cells arranged in a pattern.
  * Blocks can be rotated and positioned on the game board.
+ *
+ * The cell layout of every (shape, rotation) pair is computed at compile time
+ * in a single table, so a Block only stores which shape it is and which
+ * rotation it is in.
  */
 
 export module block;
 
-import <vector>;
+import <array>;
+import <cstdint>;
 import position;
 
+/**
+ * @struct Orientation
+ * @brief Precomputed data for one rotation state of a block shape
+ *
+ * Everything the game needs about a rotated block: its cells, its bounding
+ * box, one column mask per bounding-box row (for mask-based collision tests),
+ * the lowest cell of each bounding-box column (for landing tests) and the
+ * origin shift that keeps the lower-left corner of the bounding box
+ * fixed when rotating away from this state.
+ */
+export struct Orientation {
+    std::array<Position, 4> cells;          ///< Cell offsets relative to the block origin
+    int minRow = 0;                         ///< Bounding box: top row
+    int maxRow = 0;                         ///< Bounding box: bottom row
+    int minCol = 0;                         ///< Bounding box: left column
+    int maxCol = 0;                         ///< Bounding box: right column
+    std::array<std::uint8_t, 4> rowMasks{}; ///< Row minRow + i has bit (col - minCol) set per cell
+    std::array<int, 4> colBottoms{};        ///< Lowest cell row of column minCol + i
+    Position cwShift;                       ///< Origin shift applied by a clockwise rotation
+    Position ccwShift;                      ///< Origin shift applied by a counter-clockwise rotation
+};
+
+/**
+ * @struct Shape
+ * @brief Immutable description of one tetromino type
+ */
+export struct Shape {
+    char symbol;                            ///< Character symbol (I, J, L, O, S, T, Z)
+    int rotationCount;                      ///< Number of distinct rotation states (1, 2 or 4)
+    std::array<Orientation, 4> orientations;///< Indexed by rotation state
+};
+
+/**
+ * @brief Builds a Shape from the raw cells of each rotation state
+ *
+ * Fills in bounding boxes, row masks, column bottoms and the lower-left
+ * anchored rotation shifts: rotating from state a to state b moves the origin by
+ * (a.maxRow - b.maxRow, a.minCol - b.minCol).
+ */
+constexpr Shape makeShape(char symbol, int rotationCount,
+                          const std::array<std::array<Position, 4>, 4>& cells) {
+    Shape shape{symbol, rotationCount, {}};
+    for (int r = 0; r < rotationCount; ++r) {
+        Orientation& o = shape.orientations[r];
+        o.cells = cells[r];
+        o.minRow = o.maxRow = cells[r][0].row;
+        o.minCol = o.maxCol = cells[r][0].col;
+        for (const auto& cell : cells[r]) {
+            if (cell.row < o.minRow) o.minRow = cell.row;
+            if (cell.row > o.maxRow) o.maxRow = cell.row;
+            if (cell.col < o.minCol) o.minCol = cell.col;
+            if (cell.col > o.maxCol) o.maxCol = cell.col;
+        }
+        for (auto& bottom : o.colBottoms) bottom = o.minRow - 1;
+        for (const auto& cell : cells[r]) {
+            o.rowMasks[cell.row - o.minRow] |= static_cast<std::uint8_t>(1u << (cell.col - o.minCol));
+            int& bottom = o.colBottoms[cell.col - o.minCol];
+            if (cell.row > bottom) bottom = cell.row;
+        }
+    }
+    for (int r = 0; r < rotationCount; ++r) {
+        Orientation& o = shape.orientations[r];
+        const Orientation& cw = shape.orientations[(r + 1) % rotationCount];
+        const Orientation& ccw = shape.orientations[(r + rotationCount - 1) % rotationCount];
+        o.cwShift = Position{o.maxRow - cw.maxRow, o.minCol - cw.minCol};
+        o.ccwShift = Position{o.maxRow - ccw.maxRow, o.minCol - ccw.minCol};
+    }
+    return shape;
+}
+
+/**
+ * @brief Compile-time table of all seven shapes, indexed I, J, L, O, S, T, Z
+ *
+ * Cell layouts use a local 3x3 box (rows 0..2, cols 0..2) except for I,
+ * whose vertical state grows upwards so that its bottom row stays at 0.
+ */
+export inline constexpr std::array<Shape, 7> SHAPES = {
+    // I: horizontal / vertical
+    makeShape('I', 2, {{
+        {Position{0, 0}, Position{0, 1}, Position{0, 2}, Position{0, 3}},
+        {Position{0, 0}, Position{-1, 0}, Position{-2, 0}, Position{-3, 0}},
+    }}),
+    // J
+    makeShape('J', 4, {{
+        {Position{1, 0}, Position{1, 1}, Position{1, 2}, Position{2, 0}},
+        {Position{0, 1}, Position{1, 1}, Position{2, 1}, Position{2, 0}},
+        {Position{1, 2}, Position{2, 0}, Position{2, 1}, Position{2, 2}},
+        {Position{0, 0}, Position{0, 1}, Position{1, 0}, Position{2, 0}},
+    }}),
+    // L
+    makeShape('L', 4, {{
+        {Position{1, 0}, Position{1, 1}, Position{1, 2}, Position{2, 2}},
+        {Position{0, 1}, Position{1, 1}, Position{2, 1}, Position{2, 2}},
+        {Position{1, 0}, Position{1, 1}, Position{1, 2}, Position{2, 0}},
+        {Position{0, 0}, Position{0, 1}, Position{1, 1}, Position{2, 1}},
+    }}),
+    // O: rotation has no effect
+    makeShape('O', 1, {{
+        {Position{0, 0}, Position{0, 1}, Position{1, 0}, Position{1, 1}},
+    }}),
+    // S: horizontal / vertical
+    makeShape('S', 2, {{
+        {Position{1, 1}, Position{1, 2}, Position{2, 0}, Position{2, 1}},
+        {Position{0, 0}, Position{1, 0}, Position{1, 1}, Position{2, 1}},
+    }}),
+    // T: pointing up, right, down, left
+    makeShape('T', 4, {{
+        {Position{1, 0}, Position{1, 1}, Position{1, 2}, Position{2, 1}},
+        {Position{0, 0}, Position{1, 0}, Position{1, 1}, Position{2, 0}},
+        {Position{1, 1}, Position{2, 0}, Position{2, 1}, Position{2, 2}},
+        {Position{0, 1}, Position{1, 0}, Position{1, 1}, Position{2, 1}},
+    }}),
+    // Z: horizontal / vertical
+    makeShape('Z', 2, {{
+        {Position{1, 0}, Position{1, 1}, Position{2, 1}, Position{2, 2}},
+        {Position{0, 1}, Position{1, 0}, Position{1, 1}, Position{2, 0}},
+    }}),
+};
+
 /**
  * @class Block
- * @brief Abstract base class representing a Tetris block (tetromino)
- * 
+ * @brief A Tetris block (tetromino): a shape, a rotation state and its identity
+ *
  * The Block class represents a tetromino piece that can be placed on the board.
  * Each block consists of 4 cells arranged in a specific pattern (I, J, L, O, S, T, Z).
- * 
+ *
  * Blocks can be:
- * - Rotated clockwise or counter-clockwise
- * - Positioned on the board using an origin point
+ * - Rotated clockwise or counter-clockwise (an index change into SHAPES)
  * - Identified by a unique ID and symbol
- * 
+ *
  * Concrete block types (IBlock, JBlock, etc.) inherit from this class and
- * implement the rotation logic specific to each block shape.
+ * only select their shape; all geometry comes from the shared table.
  */
 export class Block {
 protected:
     int id;                              ///< Unique identifier for this block
-    std::vector<Position> cells;          ///< Relative positions of cells (relative to origin)
-    Position origin;                     ///< Origin position (top-left reference point)
-    char symbol;                         ///< Character symbol representing this block type
-    int bornLevel;                       ///< Level at which this block was generated
-    int rotation = 0;                    ///< Current rotation state (0-3)
-    
+    std::uint8_t shape;                  ///< Index into SHAPES
+    std::uint8_t rotation = 0;           ///< Current rotation state
+    std::uint8_t bornLevel;              ///< Level at which this block was generated
+
 public:
     /**
      * @brief Constructs a new Block
      * @param id Unique identifier for this block
-     * @param sym Character symbol (I, J, L, O, S, T, Z)
+     * @param sym Character symbol (I, J, L, O, S, T, Z); anything else is an I
      * @param level Level at which this block was generated
      */
     Block(int id, char sym, int level);
-    
-    /**
-     * @brief Virtual destructor for proper cleanup
-     */
-    virtual ~Block() = default;
-    
+
     /**
      * @brief Gets the block's unique ID
      * @return Block ID
      */
     int getId() const;
-    
+
     /**
      * @brief Gets the block's symbol character
      * @return Character symbol (I, J, L, O, S, T, Z)
      */
     char getSymbol() const;
-    
+
     /**
      * @brief Gets the level at which this block was generated
      * @return Born level (0-4)
-     * 
+     *
      * Used for scoring when blocks are completely removed.
      */
     int getBornLevel() const;
-    
+
     /**
-     * @brief Gets the relative positions of all cells
-     * @return Const reference to vector of cell positions (relative to origin)
+     * @brief Gets the current rotation state
+     * @return Rotation index (0 .. rotation count - 1)
      */
-    const std::vector<Position>& getCells() const;
+    int getRotation() const;
     
     /**
-     * @brief Gets the origin position
-     * @return Origin position
+     * @brief Gets the number of distinct rotation states of the shape
+     * @return 1 (O), 2 (I, S, Z) or 4 (J, L, T)
      */
-    Position getOrigin() const;
-    
+    int getRotationCount() const;
+
+    /**
+     * @brief Gets the precomputed data of the current rotation state
+     * @return Reference into the static shape table
+     */
+    const Orientation& getOrientation() const {
+        return SHAPES[shape].orientations[rotation];
+    }
+
+    /**
+     * @brief Gets the relative positions of all cells
+     * @return Const reference to the 4 cell positions (relative to origin)
+     */
+    const std::array<Position, 4>& getCells() const;
+
     /**
      * @brief Gets the bounding box of the block
      * @param minRow Output: minimum row coordinate
      * @param maxRow Output: maximum row coordinate
      * @param minCol Output: minimum column coordinate
      * @param maxCol Output: maximum column coordinate
-     * 
-     * Calculates the bounding rectangle that contains all cells of the block.
-     * Used for rotation position adjustments.
+     *
+     * Reads the bounding rectangle of the current rotation from the table.
      */
     void getBoundingBox(int& minRow, int& maxRow, int& minCol, int& maxCol) const;
-    
+
     /**
-     * @brief Rotates the block clockwise
-     * 
-     * Pure virtual method - must be implemented by concrete block types.
-     * Each block type has its own rotation pattern.
+     * @brief Gets the origin shift that goes with the next rotation
+     * @param clockwise Direction of the rotation about to be applied
+     * @return Offset to add to the block position so the lower-left corner
+     *         of the bounding box stays in place
      */
-    virtual void rotateCW() = 0;
-    
+    Position getRotationShift(bool clockwise) const;
+
     /**
-     * @brief Rotates the block counter-clockwise
-     * 
-     * Pure virtual method - must be implemented by concrete block types.
-     * Each block type has its own rotation pattern.
+     * @brief Rotates the block clockwise
      */
-    virtual void rotateCCW() = 0;
-    
+    void rotateCW();
+
     /**
-     * @brief Sets the origin position of the block
-     * @param pos New origin position
-     * 
-     * Changes where the block is positioned on the board. All cell
-     * positions are relative to this origin.
+     * @brief Rotates the block counter-clockwise
      */
-    void setOrigin(const Position& pos);
+    void rotateCCW();
 };
-
-
@@ -0,0 +1,5 @@
+// BlockDistribution module - implementation
+module blockdistribution;
+
+// The tables are built at compile time and sampling is inline in the
+// interface, so a level's refill loop compiles down to the draws alone.
@@ -0,0 +1,152 @@
+/**
+ * @file blockdistribution.cc
+ * @brief Interface for BlockDistribution (weighted block-type sampling)
+ *
+ * The random levels differ only in how likely each block type is. Each
+ * level declares integer weights over the seven types, which are compiled
+ * into an alias table at compile time, so drawing a block is one bounded
+ * random number and one table lookup regardless of the weights.
+ */
+
+export module blockdistribution;
+
+import <array>;
+import <cstdint>;
+import <span>;
+import rng;
+
+/// Number of block types a distribution ranges over
+export inline constexpr int BLOCK_TYPES = 7;
+
+/// Block types in table order
+export inline constexpr std::array<char, BLOCK_TYPES> BLOCK_SYMBOLS =
+    {'I', 'J', 'L', 'O', 'S', 'T', 'Z'};
+
+/**
+ * @brief Draws a uniform number in [0, range) without modulo bias
+ *
+ * Lemire's multiply-and-shift method: the high half of next() * range is
+ * the result, and the rare draws that would over-represent small values
+ * are rejected. Needs no division except on the (rare) rejection path.
+ */
+export inline std::uint32_t uniformBelow(Rng &rng, std::uint32_t range) {
+    std::uint64_t m = static_cast<std::uint64_t>(rng.next()) * range;
+    std::uint32_t low = static_cast<std::uint32_t>(m);
+    if (low < range) {
+        std::uint32_t threshold = -range % range;
+        while (low < threshold) {
+            m = static_cast<std::uint64_t>(rng.next()) * range;
+            low = static_cast<std::uint32_t>(m);
+        }
+    }
+    return static_cast<std::uint32_t>(m >> 32);
+}
+
+/**
+ * @class BlockDistribution
+ * @brief Alias table for one weighting of the block types
+ *
+ * Built with Vose's method in integer arithmetic: every column has
+ * capacity equal to the total weight, column k keeps type k for the first
+ * threshold[k] units and gives the rest to alias[k]. A draw picks a column
+ * and a unit within it from a single uniform number, so the sampled
+ * probabilities equal the declared weights exactly.
+ */
+export class BlockDistribution {
+    std::array<std::uint32_t, BLOCK_TYPES> threshold{};  ///< Units of column k kept by type k
+    std::array<std::uint8_t, BLOCK_TYPES> alias{};       ///< Type receiving the rest of column k
+    std::array<std::array<char, 2>, BLOCK_TYPES> outcome{};  ///< Symbols of k and alias[k]
+    std::array<std::uint32_t, BLOCK_TYPES> weights{};    ///< Declared weights
+    std::uint32_t total = 0;                             ///< Sum of the weights
+    std::uint64_t reciprocal = 0;                        ///< ceil(2^32 / total), to divide by total
+
+public:
+    /**
+     * @brief Builds the alias table
+     * @param weights Relative weight of each type, in BLOCK_SYMBOLS order
+     */
+    constexpr BlockDistribution(const std::array<std::uint32_t, BLOCK_TYPES> &weights)
+        : weights{weights} {
+        for (std::uint32_t w : weights) total += w;
+        reciprocal = ((std::uint64_t{1} << 32) + total - 1) / total;
+
+        // Each column holds `total` units; type k brings weights[k] * BLOCK_TYPES
+        std::array<std::uint64_t, BLOCK_TYPES> units{};
+        std::array<int, BLOCK_TYPES> small{}, large{};
+        int smallCount = 0, largeCount = 0;
+        for (int k = 0; k < BLOCK_TYPES; ++k) {
+            units[k] = static_cast<std::uint64_t>(weights[k]) * BLOCK_TYPES;
+            alias[k] = static_cast<std::uint8_t>(k);
+            if (units[k] < total) small[smallCount++] = k;
+            else large[largeCount++] = k;
+        }
+        while (smallCount > 0 && largeCount > 0) {
+            int s = small[--smallCount];
+            int l = large[--largeCount];
+            threshold[s] = static_cast<std::uint32_t>(units[s]);
+            alias[s] = static_cast<std::uint8_t>(l);
+            units[l] -= total - units[s];
+            if (units[l] < total) small[smallCount++] = l;
+            else large[largeCount++] = l;
+        }
+        while (largeCount > 0) threshold[large[--largeCount]] = total;
+        while (smallCount > 0) threshold[small[--smallCount]] = total;
+        for (int k = 0; k < BLOCK_TYPES; ++k) {
+            outcome[k] = {BLOCK_SYMBOLS[k], BLOCK_SYMBOLS[alias[k]]};
+        }
+    }
+
+    /**
+     * @brief Checks that the table reproduces the declared weights exactly
+     *
+     * Sums the units each type receives over all columns, and checks the
+     * division-free column lookup over every possible draw; used to verify
+     * the level tables at compile time.
+     */
+    constexpr bool isExact() const {
+        for (int type = 0; type < BLOCK_TYPES; ++type) {
+            std::uint64_t units = 0;
+            for (int k = 0; k < BLOCK_TYPES; ++k) {
+                if (k == type) units += threshold[k];
+                if (alias[k] == type) units += total - threshold[k];
+            }
+            if (units != static_cast<std::uint64_t>(weights[type]) * BLOCK_TYPES) return false;
+        }
+        for (std::uint32_t x = 0; x < BLOCK_TYPES * total; ++x) {
+            if (columnOf(x) != x / total) return false;
+        }
+        return total > 0;
+    }
+
+    /// x / total by multiplication; exact for every x a draw can produce.
+    constexpr std::uint32_t columnOf(std::uint32_t x) const {
+        return static_cast<std::uint32_t>((x * reciprocal) >> 32);
+    }
+
+    /// Draws one block type. The final pick is an index, not a branch, since
+    /// which side of the threshold a draw lands on is unpredictable.
+    char sample(Rng &rng) const {
+        std::uint32_t x = uniformBelow(rng, BLOCK_TYPES * total);
+        std::uint32_t column = columnOf(x);
+        std::uint32_t unit = x - column * total;
+        return outcome[column][unit >= threshold[column]];
+    }
+
+    /// Draws out.size() block types in order, as repeated sample() calls
+    /// would. The generator is copied into a local for the batch so its
+    /// state stays in registers.
+    void sample(Rng &rng, std::span<char> out) const {
+        Rng local = rng;
+        for (char &type : out) type = sample(local);
+        rng = local;
+    }
+};
+
+/// Level 1: S and Z 1/12 each, the others 1/6 each
+export inline constexpr BlockDistribution LEVEL1_BLOCKS{{2, 2, 2, 2, 1, 2, 1}};
+/// Level 2: all types equally likely
+export inline constexpr BlockDistribution LEVEL2_BLOCKS{{1, 1, 1, 1, 1, 1, 1}};
+/// Levels 3 and 4: S and Z 2/9 each, the others 1/9 each
+export inline constexpr BlockDistribution LEVEL3_BLOCKS{{1, 1, 1, 1, 2, 1, 2}};
+
+static_assert(LEVEL1_BLOCKS.isExact() && LEVEL2_BLOCKS.isExact() && LEVEL3_BLOCKS.isExact());
@@ -1,195 +1,283 @@
 // Board module - implementation
 module board;
 
-import <vector>;
-import <memory>;
-import <map>;
-import <utility>;
-import <algorithm>;
-import cell;
+import <array>;
+import <cstdint>;
+import <bit>;
 import block;
+import cell;
 import position;
 
-Board::Board() {
-    grid.resize(ROWS);
-    for (auto& row : grid) {
-        row.resize(COLS);
+template <int Rows, int Cols>
+BasicBoard<Rows, Cols>::BasicBoard() {
+    reset();
+}
+
+template <int Rows, int Cols>
+typename BasicBoard<Rows, Cols>::SlotIndex BasicBoard<Rows, Cols>::slotFor(int blockId) {
+    // A forced block keeps the ID of the block it replaces, so each ID is
+    // normally placed once. If a caller places the same ID again, both
+    // placements count as one block.
+    for (int w = 0; w < SLOT_WORDS; ++w) {
+        for (std::uint64_t bits = liveSlots[w]; bits; bits &= bits - 1) {
+            int s = w * 64 + std::countr_zero(bits);
+            if (blockIds[s] == blockId) return static_cast<SlotIndex>(s);
+        }
+    }
+    int slot = 0;
+    for (int w = 0; w < SLOT_WORDS; ++w) {
+        if (~liveSlots[w]) {
+            slot = w * 64 + std::countr_zero(~liveSlots[w]);
+            break;
+        }
     }
+    blockIds[slot] = blockId;
+    return static_cast<SlotIndex>(slot);
 }
 
-int Board::getRows() const { return ROWS; }
-int Board::getCols() const { return COLS; }
+template <int Rows, int Cols>
+bool BasicBoard<Rows, Cols>::releaseCell(SlotIndex slot) {
+    if (slot == NO_SLOT) return false;
+    if (--blockTable[slot].liveCells > 0) return false;
+    liveSlots[slot / 64] &= ~(std::uint64_t{1} << (slot % 64));
+    return true;
+}
 
-bool Board::canPlace(const Block& block, const Position& pos) const {
-    for (const auto& cell : block.getCells()) {
-        int r = pos.row + cell.row;
-        int c = pos.col + cell.col;
-        
-        if (r < 0 || r >= ROWS || c < 0 || c >= COLS) return false;
-        if (grid[r][c].isOccupied()) return false;
+// Removes the bits of fullRows from a column mask; rows above each removed
+// row move down by one. Processing top to bottom keeps lower indices valid.
+template <typename Mask>
+static Mask removeRows(Mask column, Mask fullRows) {
+    while (fullRows) {
+        int r = std::countr_zero(fullRows);
+        Mask bit = Mask{1} << r;
+        Mask above = bit - 1;
+        column = (column & ~(above | bit)) | ((column & above) << 1);
+        fullRows &= fullRows - 1;
+    }
+    return column;
+}
+
+template <int Rows, int Cols>
+void BasicBoard<Rows, Cols>::setOccupied(int row, int col, bool filled) {
+    if (filled) {
+        occupancy[row] |= static_cast<RowMask>(RowMask{1} << col);
+        columns[col] |= ColumnMask{1} << row;
+    } else {
+        occupancy[row] &= static_cast<RowMask>(~(RowMask{1} << col));
+        columns[col] &= ~(ColumnMask{1} << row);
+    }
+}
+
+template <int Rows, int Cols>
+int BasicBoard<Rows, Cols>::topmostOccupied(int col) const {
+    return columns[col] ? std::countr_zero(columns[col]) : ROWS;
+}
+
+template <int Rows, int Cols>
+void BasicBoard<Rows, Cols>::clearTopRows(int count) {
+    for (int r = 0; r < count; ++r) {
+        occupancy[r] = 0;
+        cells[r].fill(Cell{});
+    }
+}
+
+template <int Rows, int Cols>
+bool BasicBoard<Rows, Cols>::canPlace(const Block& block, const Position& pos) const {
+    // One mask AND per row of the block's bounding box
+    const Orientation& o = block.getOrientation();
+    int top = pos.row + o.minRow;
+    int left = pos.col + o.minCol;
+
+    if (top < 0 || pos.row + o.maxRow >= ROWS || left < 0 || pos.col + o.maxCol >= COLS) return false;
+
+    int height = o.maxRow - o.minRow + 1;
+    for (int i = 0; i < height; ++i) {
+        if (occupancy[top + i] & (RowMask{o.rowMasks[i]} << left)) return false;
     }
     return true;
 }
 
-void Board::place(const Block& block, const Position& pos) {
+template <int Rows, int Cols>
+void BasicBoard<Rows, Cols>::place(const Block& block, const Position& pos) {
+    SlotIndex slot = NO_SLOT;
+    if (block.getId() >= 0) {
+        slot = slotFor(block.getId());
+        if (blockTable[slot].liveCells == 0) {
+            blockTable[slot].bornLevel = static_cast<std::uint8_t>(block.getBornLevel());
+        }
+    }
+
     for (const auto& cell : block.getCells()) {
         int r = pos.row + cell.row;
         int c = pos.col + cell.col;
-        
+
         if (r >= 0 && r < ROWS && c >= 0 && c < COLS) {
-            grid[r][c].set(block.getSymbol(), block.getId(), block.getBornLevel());
+            if (occupancy[r] & (RowMask{1} << c)) {
+                if (cells[r][c].getSlot() == slot && slot != NO_SLOT) continue;  // already counted
+                releaseCell(cells[r][c].getSlot());  // overwritten cell leaves its old block
+                hash ^= cellKey(r, c, cells[r][c].getSymbol());
+            }
+            setOccupied(r, c, true);
+            hash ^= cellKey(r, c, block.getSymbol());
+            cells[r][c].set(block.getSymbol(), slot);
+            if (slot != NO_SLOT) ++blockTable[slot].liveCells;
         }
     }
+
+    // A block with no cells on the board does not take a slot
+    if (slot != NO_SLOT && blockTable[slot].liveCells > 0) {
+        liveSlots[slot / 64] |= std::uint64_t{1} << (slot % 64);
+    }
 }
 
-void Board::remove(const Block& block, const Position& pos) {
+template <int Rows, int Cols>
+void BasicBoard<Rows, Cols>::remove(const Block& block, const Position& pos) {
     for (const auto& cell : block.getCells()) {
         int r = pos.row + cell.row;
         int c = pos.col + cell.col;
-        
-        if (r >= 0 && r < ROWS && c >= 0 && c < COLS) {
-            grid[r][c].unset();
+
+        if (r >= 0 && r < ROWS && c >= 0 && c < COLS && (occupancy[r] & (RowMask{1} << c))) {
+            releaseCell(cells[r][c].getSlot());
+            setOccupied(r, c, false);
+            hash ^= cellKey(r, c, cells[r][c].getSymbol());
+            cells[r][c].unset();
         }
     }
 }
 
-int Board::clearFullRows() {
+template <int Rows, int Cols>
+int BasicBoard<Rows, Cols>::clearFullRows() {
     auto result = clearFullRowsWithBlockInfo();
     return result.rowsCleared;
 }
 
-Board::ClearRowsResult Board::clearFullRowsWithBlockInfo() {
-    // Track block cell counts before clearing
-    std::map<int, int> blockCellCounts;  // blockId -> cell count
-    std::map<int, int> blockBornLevels;  // blockId -> bornLevel
-    
-    // Count cells for each block
-    for (int r = 0; r < ROWS; ++r) {
-        for (int c = 0; c < COLS; ++c) {
-            if (grid[r][c].isOccupied()) {
-                int blockId = grid[r][c].getBlockId();
-                if (blockId >= 0) {  // Valid block ID
-                    blockCellCounts[blockId]++;
-                    if (blockBornLevels.find(blockId) == blockBornLevels.end()) {
-                        blockBornLevels[blockId] = grid[r][c].getBornLevel();
-                    }
+template <int Rows, int Cols>
+typename BasicBoard<Rows, Cols>::ClearRowsResult BasicBoard<Rows, Cols>::clearFullRowsWithBlockInfo() {
+    ClearRowsResult result;
+    ColumnMask fullRows = 0;
+
+    // Compact the non-full rows towards the bottom, in place. Only the cells
+    // of full rows touch the block table; only cleared and moved cells touch
+    // the hash.
+    int dst = ROWS - 1;
+    for (int src = ROWS - 1; src >= 0; --src) {
+        if (occupancy[src] == FULL_ROW) {
+            for (int c = 0; c < COLS; ++c) {
+                hash ^= cellKey(src, c, cells[src][c].getSymbol());
+                SlotIndex slot = cells[src][c].getSlot();
+                if (releaseCell(slot)) {
+                    // Block is completely removed - store its bornLevel for scoring
+                    result.removedBlockBornLevels.push_back(blockTable[slot].bornLevel);
                 }
             }
+            ++result.rowsCleared;
+            fullRows |= ColumnMask{1} << src;
+            continue;
         }
-    }
-    
-    // Find full rows
-    int cleared = 0;
-    std::vector<bool> isFullRow(ROWS, false);
-    for (int r = ROWS - 1; r >= 0; --r) {
-        bool full = true;
-        for (int c = 0; c < COLS; ++c) {
-            if (!grid[r][c].isOccupied()) {
-                full = false;
-                break;
+        if (dst != src) {
+            for (std::uint64_t bits = occupancy[src]; bits; bits &= bits - 1) {
+                int c = std::countr_zero(bits);
+                char symbol = cells[src][c].getSymbol();
+                hash ^= cellKey(src, c, symbol) ^ cellKey(dst, c, symbol);
             }
+            occupancy[dst] = occupancy[src];
+            cells[dst] = cells[src];
         }
-        
-        if (full) {
-            isFullRow[r] = true;
-            ++cleared;
-        }
+        --dst;
     }
-    
-    // Build new grid: keep non-full rows, add empty rows at top for cleared rows
-    std::vector<std::vector<Cell>> newGrid;
-    newGrid.reserve(ROWS);
-    
-    // Add empty rows at top for cleared rows
-    for (int i = 0; i < cleared; ++i) {
-        newGrid.push_back(std::vector<Cell>(COLS));
-    }
-    
-    // Copy non-full rows
-    for (int r = 0; r < ROWS; ++r) {
-        if (!isFullRow[r]) {
-            newGrid.push_back(grid[r]);
-        }
+
+    // Empty rows enter at the top for every row that was cleared
+    clearTopRows(result.rowsCleared);
+    if (fullRows) {
+        for (auto& column : columns) column = removeRows(column, fullRows);
     }
-    
-    // Replace old grid with new grid
-    grid = std::move(newGrid);
-    
-    // Count cells for each block after clearing
-    std::map<int, int> blockCellCountsAfter;
-    for (int r = 0; r < ROWS; ++r) {
-        for (int c = 0; c < COLS; ++c) {
-            if (grid[r][c].isOccupied()) {
-                int blockId = grid[r][c].getBlockId();
-                if (blockId >= 0) {
-                    blockCellCountsAfter[blockId]++;
-                }
-            }
-        }
+
+    return result;
+}
+
+template <int Rows, int Cols>
+void BasicBoard<Rows, Cols>::drop(int col) {
+    // Place one row above the topmost occupied cell (bottom row if empty);
+    // a column that is full up to the top cannot take another cell
+    int row = topmostOccupied(col) - 1;
+    if (row < 0) return;
+
+    setOccupied(row, col, true);
+    hash ^= cellKey(row, col, '*');
+    cells[row][col].set('*', NO_SLOT);
+}
+
+template <int Rows, int Cols>
+int BasicBoard<Rows, Cols>::dropDistance(const Block& block, const Position& pos) const {
+    if (!canPlace(block, pos)) {
+        // Overlapping start (e.g. after a failed spawn): step like move("down")
+        int distance = 0;
+        while (canPlace(block, Position{pos.row + distance + 1, pos.col})) ++distance;
+        return distance;
     }
-    
-    // Find completely removed blocks (all cells cleared)
-    // Only need bornLevel for scoring, not blockId
-    std::vector<int> removedBlockBornLevels;
-    for (const auto& [blockId, countBefore] : blockCellCounts) {
-        int countAfter = blockCellCountsAfter[blockId];
-        if (countAfter == 0) {
-            // Block is completely removed - store its bornLevel for scoring
-            removedBlockBornLevels.push_back(blockBornLevels[blockId]);
-        }
+
+    const Orientation& o = block.getOrientation();
+    int distance = ROWS;
+    for (int i = 0; i <= o.maxCol - o.minCol; ++i) {
+        int c = pos.col + o.minCol + i;
+        int bottom = pos.row + o.colBottoms[i];
+        // First filled row below the block's lowest cell in this column
+        ColumnMask below = columns[c] >> (bottom + 1);
+        int landing = below ? bottom + 1 + std::countr_zero(below) : ROWS;
+        if (landing - bottom - 1 < distance) distance = landing - bottom - 1;
     }
-    
-    return Board::ClearRowsResult(cleared, removedBlockBornLevels);
+    return distance;
 }
 
-void Board::drop(int col) {
-    // Find the topmost (lowest row number) occupied cell in the column
-    int topmostOccupied = -1;
-    for (int r = 0; r < ROWS; ++r) {
-        if (grid[r][col].isOccupied()) {
-            topmostOccupied = r;
-            break;
-        }
-    }
-    
-    if (topmostOccupied == -1) {
-        // Column is empty, place at the bottom
-        grid[ROWS - 1][col].set('*', -1, 0);
-    } else if (topmostOccupied > 0) {
-        // Place one row above the topmost occupied cell
-        grid[topmostOccupied - 1][col].set('*', -1, 0);
+template <int Rows, int Cols>
+int BasicBoard<Rows, Cols>::getColumnHeight(int col) const {
+    return ROWS - topmostOccupied(col);
+}
+
+template <int Rows, int Cols>
+int BasicBoard<Rows, Cols>::countHoles() const {
+    int holes = 0;
+    for (int c = 0; c < COLS; ++c) {
+        holes += getColumnHeight(c) - std::popcount(columns[c]);
     }
-    // If topmostOccupied == 0, column is full from top, cannot place
+    return holes;
 }
 
-char Board::getCell(int row, int col) const {
+template <int Rows, int Cols>
+char BasicBoard<Rows, Cols>::getCell(int row, int col) const {
     if (row < 0 || row >= ROWS || col < 0 || col >= COLS) return ' ';
-    
+
     // Blind effect: columns 3-9, rows 3-12 are covered with '?'
     if (isBlind && row >= 3 && row <= 12 && col >= 3 && col <= 9) {
         return '?';
     }
-    
-    return grid[row][col].isOccupied() ? grid[row][col].getSymbol() : ' ';
+
+    return cells[row][col].getSymbol();
 }
 
-void Board::toggleBlind() {
+template <int Rows, int Cols>
+void BasicBoard<Rows, Cols>::toggleBlind() {
     isBlind = !isBlind;
 }
 
-void Board::setBlind(bool enabled) {
+template <int Rows, int Cols>
+void BasicBoard<Rows, Cols>::setBlind(bool enabled) {
     isBlind = enabled;
 }
 
-void Board::reset() {
-    for (auto& row : grid) {
-        for (auto& cell : row) {
-            cell.unset();
-        }
-    }
+template <int Rows, int Cols>
+void BasicBoard<Rows, Cols>::reset() {
+    clearTopRows(ROWS);
+    columns.fill(0);
+    blockTable.fill(BlockSlot{0, 0});
+    blockIds.fill(-1);
+    liveSlots.fill(0);
+    hash = 0;
     // Reset blind effect state
     isBlind = false;
 }
 
-
-
+// The game board, plus wide variants for stress testing
+template class BasicBoard<18, 11>;
+template class BasicBoard<18, 32>;
+template class BasicBoard<18, 64>;
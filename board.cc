@@ -9,28 +9,70 @@
 
 export module board;
 
-import <vector>;
-import <memory>;
-import <utility>;
-import <map>;
-import cell;
+import <array>;
+import <cstdint>;
+import <bit>;
+import <type_traits>;
 import block;
+import cell;
 import position;
 
 /**
- * @class Board
+ * @brief Mixes a 64-bit feature code into a pseudo-random Zobrist key
+ *
+ * SplitMix64 finaliser. Keys are derived on the fly instead of being kept in
+ * a random table, so every build and every board agrees on them.
+ */
+export constexpr std::uint64_t zobristMix(std::uint64_t x) {
+    x += 0x9E3779B97F4A7C15ull;
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ull;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBull;
+    return x ^ (x >> 31);
+}
+
+/**
+ * @class BasicBoard
  * @brief Represents the game board grid where blocks are placed
+ * @tparam Rows Number of rows (at most 63)
+ * @tparam Cols Number of columns (at most 64)
  * 
- * The Board class manages a 18x11 grid of cells. It provides methods to:
+ * The BasicBoard class manages a Rows x Cols grid of cells; the game uses
+ * the 18x11 Board below. Dimensions are compile-time constants so that row
+ * scans unroll and the row mask is the smallest word that fits a row. It
+ * provides methods to:
  * - Check if blocks can be placed at specific positions
  * - Place and remove blocks
  * - Clear full rows and track removed blocks for scoring
  * - Handle special effects like blind mode
  * 
+ * Storage is a bitboard: occupancy is one word per row (bit c set when
+ * column c is filled), so collision tests and full-row checks are mask ANDs.
+ * A transposed copy (one word per column) is kept in step with it so
+ * column heights and landing rows are single bit scans.
+ * The symbol and owning block of each cell live in a plane of packed 16-bit
+ * Cells that is only touched when a cell's contents are needed.
+ *
+ * Each placed block gets a slot in a recycled block table that tracks its
+ * ID, bornLevel and how many of its cells are still on the board; cells
+ * refer to it by slot index instead of repeating the block data. Clearing a row
+ * decrements the counters of the blocks in that row only, so fully removed
+ * blocks are found without rescanning the grid.
+ *
+ * The board also keeps a 64-bit Zobrist hash of its contents: the XOR of one
+ * key per filled (row, column, symbol). place(), remove(), drop() and row
+ * clearing update it for the cells they touch only.
+ *
  * Note: Board does NOT inherit from Subject. Observers are attached to Player
  * objects, which access Board through getBoard().
  */
-export class Board {
+export template <int Rows, int Cols>
+class BasicBoard {
+    static_assert(Rows > 0 && Rows < 64, "column masks hold one bit per row, plus one");
+    static_assert(Cols > 0 && Cols <= 64, "row masks hold one bit per column");
+
+    static constexpr int ROWS = Rows;              ///< Number of rows in the board
+    static constexpr int COLS = Cols;              ///< Number of columns in the board
+    
 public:
     /**
      * @struct ClearRowsResult
@@ -44,8 +86,27 @@ public:
      * Note: Must be public because it's used as a return type for public method.
      */
     struct ClearRowsResult {
-        int rowsCleared;                           ///< Number of full rows that were cleared
-        std::vector<int> removedBlockBornLevels;   ///< bornLevel values of completely removed blocks
+        /**
+         * @brief Fixed-capacity list of bornLevel values
+         * 
+         * Stored inline so that clearing rows never allocates. Every removed
+         * block owned at least one cell of a cleared row, so the board size
+         * bounds the number of entries.
+         */
+        class BornLevels {
+            std::array<unsigned char, ROWS * COLS> levels;
+            int count = 0;
+            
+        public:
+            void push_back(int level) { levels[count++] = static_cast<unsigned char>(level); }
+            int size() const { return count; }
+            bool empty() const { return count == 0; }
+            const unsigned char* begin() const { return levels.data(); }
+            const unsigned char* end() const { return levels.data() + count; }
+        };
+        
+        int rowsCleared;                   ///< Number of full rows that were cleared
+        BornLevels removedBlockBornLevels; ///< bornLevel values of completely removed blocks
         
         /**
          * @brief Default constructor
@@ -53,34 +114,26 @@ public:
          * Initializes with 0 rows cleared and empty removed blocks list.
          */
         ClearRowsResult() : rowsCleared(0) {}
-        
-        /**
-         * @brief Constructor with parameters
-         * @param rows Number of rows cleared
-         * @param levels Vector of bornLevel values for removed blocks
-         */
-        ClearRowsResult(int rows, const std::vector<int>& levels) 
-            : rowsCleared(rows), removedBlockBornLevels(levels) {}
     };
     
     /**
      * @brief Constructs a new empty Board
      * 
-     * Initializes an 18x11 grid of empty cells.
+     * Initializes a Rows x Cols grid of empty cells.
      */
-    Board();
+    BasicBoard();
     
     /**
      * @brief Gets the number of rows in the board
-     * @return Number of rows (18)
+     * @return Number of rows (18 for the game board)
      */
-    int getRows() const;
+    static constexpr int getRows() { return ROWS; }
     
     /**
      * @brief Gets the number of columns in the board
-     * @return Number of columns (11)
+     * @return Number of columns (11 for the game board)
      */
-    int getCols() const;
+    static constexpr int getCols() { return COLS; }
     
     /**
      * @brief Checks if a block can be placed at the given position
@@ -142,6 +195,37 @@ public:
      */
     void drop(int col);
     
+    /**
+     * @brief Computes how many rows a block can fall before it lands
+     * @param block The block to drop
+     * @param pos Current position of the block
+     * @return Number of rows the block can move down
+     * 
+     * Uses the column occupancy masks: each column of the block only has
+     * to find the first filled cell below its lowest cell, so a hard drop
+     * costs one bit scan per block column instead of one collision test
+     * per row fallen. Equivalent to moving down until canPlace() fails.
+     */
+    int dropDistance(const Block& block, const Position& pos) const;
+    
+    /**
+     * @brief Gets the height of a column
+     * @param col Column index (0-10)
+     * @return Number of rows from the bottom up to and including the
+     *         topmost filled cell (0 if the column is empty)
+     */
+    int getColumnHeight(int col) const;
+    
+    /**
+     * @brief Counts the holes on the board
+     * @return Number of empty cells that have a filled cell above them in
+     *         the same column
+     * 
+     * One bit count per column: a column's holes are its height minus its
+     * filled cells.
+     */
+    int countHoles() const;
+    
     /**
      * @brief Gets the character representation of a cell
      * @param row Row index (0-17)
@@ -154,6 +238,25 @@ public:
      */
     char getCell(int row, int col) const;
     
+    /**
+     * @brief Checks whether a cell is filled, ignoring the blind effect
+     * @param row Row index (0-17)
+     * @param col Column index (0-10)
+     * @return true if the cell is on the board and filled
+     */
+    bool isOccupied(int row, int col) const {
+        return row >= 0 && row < ROWS && col >= 0 && col < COLS && (occupancy[row] >> col & 1);
+    }
+    
+    /**
+     * @brief Gets the Zobrist hash of the board contents
+     * @return XOR of the keys of all filled cells (0 for an empty board)
+     * 
+     * Depends only on which cells are filled and with which symbol; the
+     * blind effect and the block bookkeeping do not change it.
+     */
+    std::uint64_t getHash() const { return hash; }
+    
     /**
      * @brief Toggles the blind effect on/off
      * 
@@ -179,10 +282,81 @@ public:
     void reset();
 
 private:
-    static const int ROWS = 18;                    ///< Number of rows in the board
-    static const int COLS = 11;                    ///< Number of columns in the board
-    std::vector<std::vector<Cell>> grid;          ///< 2D grid of cells (ROWS x COLS)
+    /// One bit per column, in the smallest word that fits a row
+    using RowMask = std::conditional_t<(COLS <= 8), std::uint8_t,
+                    std::conditional_t<(COLS <= 16), std::uint16_t,
+                    std::conditional_t<(COLS <= 32), std::uint32_t, std::uint64_t>>>;
+    /// One bit per row, with a spare high bit so landing scans can shift by ROWS
+    using ColumnMask = std::conditional_t<(ROWS < 32), std::uint32_t, std::uint64_t>;
+    using SlotIndex = std::uint16_t;               ///< Index into the block table
+
+    static constexpr RowMask FULL_ROW = static_cast<RowMask>(~std::uint64_t{0} >> (64 - COLS));  ///< Mask of a completely filled row
+    static constexpr int MAX_SLOTS = ROWS * COLS;  ///< Every live block owns at least one cell
+    static constexpr SlotIndex NO_SLOT = Cell::NO_SLOT;  ///< Slot of cells not from a block ('*')
+    static constexpr int SLOT_WORDS = (MAX_SLOTS + 63) / 64;  ///< Words in the live-slot mask
+    static_assert(MAX_SLOTS < NO_SLOT, "every slot index must fit in a Cell");
+
+    /**
+     * @struct BlockSlot
+     * @brief Block table entry for a block that still has cells on the board
+     *
+     * The block ID is kept in a separate array so that an entry is one byte.
+     */
+    struct BlockSlot {
+        std::uint8_t liveCells : 4; ///< Cells of the block still on the board (0 = free slot)
+        std::uint8_t bornLevel : 3; ///< Level at which the block was generated
+    };
+
+    std::array<RowMask, ROWS> occupancy{};                              ///< Occupancy bitboard (bit c = column c)
+    std::array<ColumnMask, COLS> columns{};                             ///< Transposed occupancy (bit r = row r)
+    std::array<std::array<Cell, COLS>, ROWS> cells{};                   ///< Packed symbol/slot plane
+    std::array<BlockSlot, MAX_SLOTS> blockTable{};                      ///< Recycled per-board block table
+    std::array<int, MAX_SLOTS> blockIds{};                              ///< Block ID of each slot
+    std::array<std::uint64_t, SLOT_WORDS> liveSlots{};                  ///< Bit s set while slot s is in use
+    std::uint64_t hash = 0;                        ///< Zobrist hash of the filled cells
     bool isBlind = false;                          ///< Blind effect flag (columns 3-9, rows 3-12)
-};
 
+    /**
+     * @brief Gets the Zobrist key of a symbol in a cell
+     */
+    static constexpr std::uint64_t cellKey(int row, int col, char symbol) {
+        return zobristMix((static_cast<std::uint64_t>(row * COLS + col) << 8)
+                          | static_cast<unsigned char>(symbol));
+    }
+
+    /**
+     * @brief Finds the live slot of a block ID, or the lowest free one
+     * @return Slot index whose liveCells is 0 if the block is new
+     */
+    SlotIndex slotFor(int blockId);
 
+    /**
+     * @brief Decrements a slot's live-cell count, recycling it at zero
+     * @return true if this was the block's last cell on the board
+     */
+    bool releaseCell(SlotIndex slot);
+
+    /**
+     * @brief Sets or clears the occupancy of one cell in both bitboards
+     */
+    void setOccupied(int row, int col, bool filled);
+
+    /**
+     * @brief Gets the topmost filled row of a column, or ROWS if empty
+     */
+    int topmostOccupied(int col) const;
+
+    /**
+     * @brief Empties rows [0, count) in every plane
+     */
+    void clearTopRows(int count);
+};
+
+/**
+ * @brief The 18x11 board used by the game
+ *
+ * Member functions are defined in board-impl.cc and explicitly instantiated
+ * there for this size and the wide stress-test sizes; add an instantiation
+ * there to use another size.
+ */
+export using Board = BasicBoard<18, 11>;
@@ -1,70 +1,87 @@
 /**
  * @file cell.cc
  * @brief Interface for the Cell class (board cell representation)
- * 
+ *
  * This file defines the Cell class, which represents a single cell in the
  * game board grid. Each cell can be occupied by a block or empty.
  */
 
 export module cell;
 
+import <cstdint>;
+
 /**
  * @class Cell
- * @brief Represents a single cell in the game board
- * 
+ * @brief Represents a single cell in the game board, packed into 16 bits
+ *
  * A Cell can be either occupied (by a block) or empty. When occupied,
- * it stores the block's symbol, ID, and bornLevel for scoring purposes.
+ * it stores the block's symbol and the slot of the block in the board's
+ * block table, where the block's ID and bornLevel are kept once per block.
+ * Occupancy is implied by the symbol: the empty cell has symbol code 0.
+ *
+ * Layout: bits 0-3 symbol code (index into SYMBOLS), bits 4-15 block slot.
  */
 export class Cell {
-    char symbol;      ///< Character symbol of the occupying block
-    int blockId;      ///< ID of the occupying block (-1 if not from a block)
-    int bornLevel;    ///< Level at which the occupying block was generated
-    bool occupied;    ///< Whether this cell is occupied
-    
+public:
+    static constexpr std::uint16_t NO_SLOT = 0xFFF;  ///< Largest slot value; marks cells not from a block
+
+private:
+    static constexpr char SYMBOLS[] = " IJLOSTZ*";  ///< Symbol of each code
+
+    std::uint16_t bits = 0;   ///< Packed symbol code and block slot
+
+    /**
+     * @brief Maps a symbol to its code (unknown symbols are stored as '*')
+     */
+    static constexpr std::uint16_t codeOf(char sym) {
+        switch (sym) {
+            case 'I': return 1;
+            case 'J': return 2;
+            case 'L': return 3;
+            case 'O': return 4;
+            case 'S': return 5;
+            case 'T': return 6;
+            case 'Z': return 7;
+            default: return 8;
+        }
+    }
+
 public:
     /**
      * @brief Constructs an empty Cell
      */
-    Cell();
-    
+    constexpr Cell() = default;
+
     /**
      * @brief Checks if the cell is occupied
      * @return true if occupied, false if empty
      */
-    bool isOccupied() const;
-    
+    constexpr bool isOccupied() const { return (bits & 0xF) != 0; }
+
     /**
      * @brief Gets the symbol of the occupying block
-     * @return Character symbol, or undefined if empty
-     */
-    char getSymbol() const;
-    
-    /**
-     * @brief Gets the ID of the occupying block
-     * @return Block ID, or -1 if not from a block
+     * @return Character symbol, or ' ' if empty
      */
-    int getBlockId() const;
-    
+    constexpr char getSymbol() const { return SYMBOLS[bits & 0xF]; }
+
     /**
-     * @brief Gets the bornLevel of the occupying block
-     * @return Born level, or 0 if not from a block
+     * @brief Gets the block table slot of the occupying block
+     * @return Slot index, as given to set()
      */
-    int getBornLevel() const;
-    
+    constexpr std::uint16_t getSlot() const { return static_cast<std::uint16_t>(bits >> 4); }
+
     /**
      * @brief Sets the cell to occupied with block information
      * @param sym Block symbol character
-     * @param id Block ID (-1 for special cells like dropped cells)
-     * @param level Born level of the block
+     * @param slot Block table slot of the block (NO_SLOT for special cells
+     *             like dropped cells)
      */
-    void set(char sym, int id, int level);
-    
+    constexpr void set(char sym, std::uint16_t slot) {
+        bits = static_cast<std::uint16_t>(codeOf(sym) | (slot << 4));
+    }
+
     /**
      * @brief Sets the cell to empty
-     * 
-     * Clears all cell data and marks it as unoccupied.
      */
-    void unset();
+    constexpr void unset() { bits = 0; }
 };
-
-
@@ -5,13 +5,21 @@
  * This file contains the implementation of command parsing logic, including
  * input parsing, multiplier extraction, lowercase conversion, and command
  * abbreviation matching.
+ *
+ * Abbreviations are resolved with a prefix trie over the command names that
+ * is built at compile time: an input walks it one character per step, and
+ * the node it ends on knows how many commands it is a prefix of. Matching
+ * allocates nothing and does not depend on the number of commands.
  */
 
 module commandinterpreter;
 
+import <array>;
+import <charconv>;
+import <cstdint>;
 import <string>;
-import <iostream>;
-import <sstream>;
+import <string_view>;
+import action;
 
 /**
  * @brief Helper function to check if a character is a digit
@@ -34,22 +42,183 @@ static char toLowerChar(char c) {
     return c;
 }
 
+/**
+ * @brief Helper function to check if a character is whitespace
+ * @param c The character to check
+ * @return true for the characters that separate words on input
+ */
+static bool isSpaceChar(char c) {
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\f' || c == '\v';
+}
+
+/**
+ * @brief Helper function to take the next whitespace-separated word
+ * @param input The remaining input; the word is removed from its front
+ * @return The word, or an empty view if the input has no more words
+ */
+static std::string_view nextWord(std::string_view& input) {
+    std::size_t begin = 0;
+    while (begin < input.size() && isSpaceChar(input[begin])) ++begin;
+    std::size_t end = begin;
+    while (end < input.size() && !isSpaceChar(input[end])) ++end;
+    std::string_view word = input.substr(begin, end - begin);
+    input.remove_prefix(end);
+    return word;
+}
+
+/**
+ * @brief Gets the block type a testing command names
+ * @param c The single character typed
+ * @return The uppercase block type, or 0 if c names no block
+ */
+static char blockOf(char c) {
+    switch (c) {
+        case 'I': case 'i': return 'I';
+        case 'J': case 'j': return 'J';
+        case 'L': case 'l': return 'L';
+        case 'O': case 'o': return 'O';
+        case 'S': case 's': return 'S';
+        case 'T': case 't': return 'T';
+        case 'Z': case 'z': return 'Z';
+        default: return 0;
+    }
+}
+
+/**
+ * @brief Gets the full (canonical) text of a command
+ * @param type A command other than Block and Unknown
+ * @return The command as matchCommand() returns it
+ */
+static std::string_view commandText(CommandType type) {
+    switch (type) {
+        case CommandType::Left: return "left";
+        case CommandType::Right: return "right";
+        case CommandType::Down: return "down";
+        case CommandType::Clockwise: return "cw";
+        case CommandType::CounterClockwise: return "ccw";
+        case CommandType::Drop: return "drop";
+        case CommandType::Hold: return "hold";
+        case CommandType::LevelUp: return "levelup";
+        case CommandType::LevelDown: return "leveldown";
+        case CommandType::Hint: return "hint";
+        case CommandType::NoRandom: return "norandom";
+        case CommandType::Random: return "random";
+        case CommandType::Sequence: return "sequence";
+        case CommandType::Restart: return "restart";
+        case CommandType::Phantom: return "phantom";
+        case CommandType::Block:
+        case CommandType::Unknown: break;
+    }
+    return "";
+}
+
+/// A multi-character command name and the command it selects
+struct CommandName {
+    std::string_view text;
+    CommandType type;
+};
+
+/// All multi-character game commands; an input selects the one it is a
+/// unique prefix of
+static constexpr std::array<CommandName, 17> COMMAND_NAMES{{
+    {"left", CommandType::Left},
+    {"right", CommandType::Right},
+    {"down", CommandType::Down},
+    {"clockwise", CommandType::Clockwise},
+    {"counterclockwise", CommandType::CounterClockwise},
+    {"drop", CommandType::Drop},
+    {"hold", CommandType::Hold},
+    {"levelup", CommandType::LevelUp},
+    {"leveldown", CommandType::LevelDown},
+    {"norandom", CommandType::NoRandom},
+    {"random", CommandType::Random},
+    {"sequence", CommandType::Sequence},
+    {"restart", CommandType::Restart},
+    {"hint", CommandType::Hint},
+    {"cw", CommandType::Clockwise},
+    {"ccw", CommandType::CounterClockwise},
+    {"phantom", CommandType::Phantom}
+}};
+
+/// Upper bound on the trie's nodes: the root plus one per name character
+static constexpr int trieCapacity() {
+    int size = 1;
+    for (const auto& name : COMMAND_NAMES) size += static_cast<int>(name.text.size());
+    return size;
+}
+
+/// Prefix trie over COMMAND_NAMES (lowercase letters only)
+class CommandTrie {
+    static constexpr int LETTERS = 26;
+
+    struct Node {
+        std::array<std::uint8_t, LETTERS> child{};   ///< Child per letter; 0 = none
+        std::uint8_t count = 0;                      ///< Names this node is a prefix of
+        CommandType type = CommandType::Unknown;     ///< The name's command, when count == 1
+    };
+
+    std::array<Node, trieCapacity()> nodes{};
+    int size = 1;
+
+public:
+    constexpr CommandTrie() {
+        for (const auto& name : COMMAND_NAMES) {
+            int node = 0;
+            ++nodes[node].count;
+            nodes[node].type = name.type;
+            for (char c : name.text) {
+                auto& next = nodes[node].child[c - 'a'];
+                if (next == 0) next = static_cast<std::uint8_t>(size++);
+                node = next;
+                ++nodes[node].count;
+                nodes[node].type = name.type;
+            }
+        }
+    }
+
+    /// The command `input` is a unique prefix of, or Unknown if it is a
+    /// prefix of none or of several
+    constexpr CommandType find(std::string_view input) const {
+        int node = 0;
+        for (char c : input) {
+            if (c < 'a' || c > 'z') return CommandType::Unknown;
+            node = nodes[node].child[c - 'a'];
+            if (node == 0) return CommandType::Unknown;
+        }
+        return nodes[node].count == 1 ? nodes[node].type : CommandType::Unknown;
+    }
+};
+
+static constexpr CommandTrie COMMAND_TRIE;
+
+static_assert(trieCapacity() <= 256, "trie nodes are indexed by uint8_t");
+static_assert(COMMAND_TRIE.find("lef") == CommandType::Left &&
+              COMMAND_TRIE.find("cl") == CommandType::Clockwise &&
+              COMMAND_TRIE.find("cc") == CommandType::CounterClockwise &&
+              COMMAND_TRIE.find("levelu") == CommandType::LevelUp &&
+              COMMAND_TRIE.find("c") == CommandType::Unknown &&
+              COMMAND_TRIE.find("level") == CommandType::Unknown &&
+              COMMAND_TRIE.find("") == CommandType::Unknown &&
+              COMMAND_TRIE.find("lefts") == CommandType::Unknown);
+
 bool CommandInterpreter::nextCommand(const std::string& input, std::string& cmd, int& multiplier) {
     multiplier = 1;
     cmd = "";
     
-    std::istringstream iss{input};
-    std::string first;
-    
-    if (!(iss >> first)) return false;
+    std::string_view rest{input};
+    std::string_view first = nextWord(rest);
+    if (first.empty()) return false;
     
+    std::string_view word = first;
     if (isDigitChar(first[0])) {
-        multiplier = std::stoi(first);
-        if (!(iss >> cmd)) return false;
-    } else {
-        cmd = first;
+        // Leading digits of the first word are the multiplier; the command is the next word
+        auto [end, error] = std::from_chars(first.data(), first.data() + first.size(), multiplier);
+        if (error != std::errc{}) return false;
+        word = nextWord(rest);
+        if (word.empty()) return false;
     }
     
+    cmd.assign(word);
     for (char& c : cmd) {
         c = toLowerChar(c);
     }
@@ -58,57 +227,16 @@ bool CommandInterpreter::nextCommand(const std::string& input, std::string& cmd,
 }
 
 std::string CommandInterpreter::matchCommand(const std::string& input) {
+    Command command = parseCommand(input);
+    if (command.type == CommandType::Block) return std::string(1, command.block);
+    if (command.type == CommandType::Unknown) return input;
+    return std::string{commandText(command.type)};
+}
+
+Command CommandInterpreter::parseCommand(std::string_view input) {
     // Single-character testing commands (used for testing specific blocks)
     if (input.length() == 1) {
-        char c = input[0];
-        // I, J, L, O, S, T, Z are valid testing block commands
-        if (c == 'I' || c == 'i' || c == 'J' || c == 'j' || 
-            c == 'L' || c == 'l' || c == 'O' || c == 'o' || 
-            c == 'S' || c == 's' || c == 'T' || c == 't' || 
-            c == 'Z' || c == 'z') {
-            // Return uppercase for consistency
-            if (c >= 'a' && c <= 'z') {
-                c = c - ('a' - 'A');
-            }
-            return std::string(1, c);
-        }
+        if (char block = blockOf(input[0])) return Command{CommandType::Block, block};
     }
-    
-    // List of all multi-character game commands
-    const std::string commands[] = {
-        "left", "right", "down", "clockwise", "counterclockwise",
-        "drop", "hold", "levelup", "leveldown", "norandom", "random",
-        "sequence", "restart", "hint", "cw", "ccw", "phantom"
-    };
-    
-    // Count how many commands match the input prefix
-    int matchCount = 0;
-    std::string matchedCommand;
-    
-    // Try to match input as a prefix of each command (shortest unique prefix)
-    for (const auto& cmd : commands) {
-        if (cmd.find(input) == 0) {
-            matchCount++;
-            if (matchCount == 1) {
-                // Store the first match
-                matchedCommand = cmd;
-            } else {
-                // Multiple matches found - return original input (invalid command)
-                return input;
-            }
-        }
-    }
-    
-    // If exactly one match found, return it
-    if (matchCount == 1) {
-        // Special abbreviations: convert full names to short forms
-        if (matchedCommand == "clockwise") return "cw";
-        if (matchedCommand == "counterclockwise") return "ccw";
-        return matchedCommand;
-    }
-    
-    // If no match found, return the original input unchanged
-    return input;
+    return Command{COMMAND_TRIE.find(input)};
 }
-
-
@@ -10,6 +10,8 @@
 export module commandinterpreter;
 
 import <string>;
+import <string_view>;
+import action;
 
 /**
  * @class CommandInterpreter
@@ -20,6 +22,7 @@ import <string>;
  * - Command abbreviation matching (e.g., "lef" matches "left")
  * - Command multipliers (e.g., "3 right" executes "right" 3 times)
  * - Command normalization (converting to lowercase)
+ * - Parsing into a typed Command, so the game never compares strings
  */
 export class CommandInterpreter {
 public:
@@ -63,6 +66,18 @@ public:
      * - Testing: I, J, L, O, S, T, Z
      */
     static std::string matchCommand(const std::string& input);
+    
+    /**
+     * @brief Parses a command word into a typed Command
+     * @param input The abbreviated or full command string
+     * @return The matched Command, or CommandType::Unknown if the input
+     *         matches no command (or is an ambiguous prefix)
+     * 
+     * Uses the same abbreviation rules as matchCommand() and allocates
+     * nothing. This is the only place command text is interpreted;
+     * Game::handleCommand takes the result.
+     */
+    static Command parseCommand(std::string_view input);
 };
 
 
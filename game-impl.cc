@@ -9,19 +9,29 @@
 
 module game;
 
+import <cstdint>;
 import <memory>;
 import <iostream>;
 import <string>;
 import <sstream>;
+import <utility>;
+import hint;
 import player;
 import basicplayer;
-import blindeffect;
-import heavyeffect;
-import forceeffect;
 
-Game::Game() {
+Game::Game() : heuristic{std::make_unique<WeightedHeuristic>()} {
     p1 = std::make_shared<BasicPlayer>();
     p2 = std::make_shared<BasicPlayer>();
+    setSeed(1);
+}
+
+void Game::setSeed(std::uint64_t seed) {
+    p1->seedRng(seed, 1);
+    p2->seedRng(seed, 2);
+}
+
+void Game::setHeuristic(std::unique_ptr<Heuristic> h) {
+    heuristic = std::move(h);
 }
 
 void Game::run() {
@@ -46,43 +56,45 @@ void Game::switchTurn() {
     current = (current == 1) ? 2 : 1;
 }
 
-bool Game::handleCommand(const std::string& cmd, int multiplier, int* droppingPlayerNum, bool* blockDropped) {
+bool Game::handleCommand(Command command, int multiplier, int* droppingPlayerNum, bool* blockDropped) {
     auto player = getCurrentPlayer();
     bool shouldApplySpecial = false;
     bool dropped = false;
     
+    // Only movement and rotation repeat; the rest execute once (the first
+    // drop ends the turn, so there is no block left for a second one)
+    if (command.type >= CommandType::Drop && multiplier > 1) multiplier = 1;
+    
+    // Movement resolves the whole multiplier in one call (same final state
+    // as moving `multiplier` times, drawn once)
+    if (command.type == CommandType::Left || command.type == CommandType::Right ||
+        command.type == CommandType::Down) {
+        player->move(static_cast<Action>(command.type), multiplier);
+        multiplier = 0;
+    }
+    
     // Execute the command 'multiplier' times
+    // Per Piazza clarification: blocks can move/rotate as much as you like on the bottom,
+    // even if it causes collision, until drop command is issued.
     for (int i = 0; i < multiplier; ++i) {
-        // Movement commands
-        if (cmd == "left") {
-            player->move("left");
-        } else if (cmd == "right") {
-            player->move("right");
-        } else if (cmd == "down") {
-            player->move("down");
-        } 
-        // Rotation commands
-        else if (cmd == "cw" || cmd == "clockwise") {
-            player->rotate("cw");
-        } else if (cmd == "ccw" || cmd == "counterclockwise") {
-            player->rotate("ccw");
-        } 
-        // Drop command
-        else if (cmd == "drop") {
-            // Store current player number BEFORE drop to know who cleared rows
-            int droppingPlayer = current;
-            
-            player->drop();
-            dropped = true;
-            
-            // Check if special effect should be applied
-            // Unwrap decorators to get BasicPlayer
-            std::shared_ptr<Player> unwrapped = player;
-            while (unwrapped->getWrappedPlayer()) {
-                unwrapped = unwrapped->getWrappedPlayer();
-            }
-            if (auto basic = std::dynamic_pointer_cast<BasicPlayer>(unwrapped)) {
-                if (basic->canApplySpecial()) {
+        switch (command.type) {
+            // Rotation commands
+            case CommandType::Clockwise:
+                player->rotate(Action::Clockwise);
+                break;
+            case CommandType::CounterClockwise:
+                player->rotate(Action::CounterClockwise);
+                break;
+            // Drop command
+            case CommandType::Drop: {
+                // Store current player number BEFORE drop to know who cleared rows
+                int droppingPlayer = current;
+                
+                player->drop();
+                dropped = true;
+                
+                // Check if special effect should be applied
+                if (canApplySpecial()) {
                     shouldApplySpecial = true;
                     // Store which player dropped
                     // This will be used to determine the opponent
@@ -90,37 +102,47 @@ bool Game::handleCommand(const std::string& cmd, int multiplier, int* droppingPl
                         *droppingPlayerNum = droppingPlayer;
                     }
                 }
+                break;
             }
-        } 
-        // Hold command
-        else if (cmd == "hold") {
-            player->hold();
-            break; // Only execute once
-        } 
-        // Level adjustment commands (applied once regardless of multiplier)
-        else if (cmd == "levelup") {
-            player->levelUp();
-            break; // Only execute once
-        } else if (cmd == "leveldown") {
-            player->levelDown();
-            break; // Only execute once
-        }
-        // Testing commands: replace current block with specific type
-        else if (cmd == "I" || cmd == "J" || cmd == "L" || cmd == "O" || 
-                 cmd == "S" || cmd == "T" || cmd == "Z") {
-            // TODO: Implement block replacement (handled by Player/Level)
-            // player->replaceCurrentBlock(cmd[0]);
-            break; // Only execute once for block replacement
-        }
-        // Special commands
-        else if (cmd == "hint" || cmd == "norandom" || cmd == "random" || cmd == "sequence") {
-            // TODO: Implement these special commands
-            break; // These don't use multipliers
+            // Hold command
+            case CommandType::Hold:
+                player->hold();
+                break;
+            // Level adjustment commands (applied once regardless of multiplier)
+            case CommandType::LevelUp:
+                player->levelUp();
+                break;
+            case CommandType::LevelDown:
+                player->levelDown();
+                break;
+            // Testing commands: replace current block with specific type
+            case CommandType::Block:
+                player->replaceCurrentBlock(command.block);
+                break;
+            // Hint: show the best reachable placement of the current block.
+            // Off while blinded: the search reads the hidden cells, and
+            // drawing its placement would reveal them
+            case CommandType::Hint:
+                if (player->hasBlindEffect()) break;
+                if (auto hint = hintFinder.find(*player, *heuristic)) {
+                    player->setHint(hint->block, hint->pos);  // observers draw it until the state changes
+                }
+                break;
+            // Movement (handled above), commands handled outside the game
+            // (main.cc), commands that are recognised but not supported
+            // (norandom and sequence need a file name, which Command does
+            // not carry), or not a command
+            case CommandType::Left:
+            case CommandType::Right:
+            case CommandType::Down:
+            case CommandType::Restart:
+            case CommandType::Phantom:
+            case CommandType::NoRandom:
+            case CommandType::Random:
+            case CommandType::Sequence:
+            case CommandType::Unknown:
+                break;
         }
-        
-        // Per Piazza clarification: blocks can move/rotate as much as you like on the bottom,
-        // even if it causes collision, until drop command is issued.
-        // Removed lock delay auto-drop logic to allow unlimited moves at bottom.
     }
     
     // Set output parameter if block was dropped
@@ -139,14 +161,7 @@ bool Game::isGameOver() {
 }
 
 void Game::restart() {
-    // Unwrap any effects before reset
-    while (p1->getWrappedPlayer()) {
-        p1 = p1->getWrappedPlayer();
-    }
-    while (p2->getWrappedPlayer()) {
-        p2 = p2->getWrappedPlayer();
-    }
-    
+    // reset() also clears any effects played on the players
     p1->reset();
     p2->reset();
     current = 1;
@@ -156,15 +171,7 @@ void Game::restart() {
 }
 
 bool Game::canApplySpecial() const {
-    // Unwrap decorators to get BasicPlayer
-    std::shared_ptr<Player> unwrapped = (current == 1) ? p1 : p2;
-    while (unwrapped->getWrappedPlayer()) {
-        unwrapped = unwrapped->getWrappedPlayer();
-    }
-    if (auto basic = std::dynamic_pointer_cast<BasicPlayer>(unwrapped)) {
-        return basic->canApplySpecial();
-    }
-    return false;
+    return (current == 1 ? p1 : p2)->canApplySpecial();
 }
 
 bool Game::applySpecialEffect(const std::string& effect, int targetPlayer) {
@@ -184,24 +191,16 @@ bool Game::applySpecialEffect(const std::string& effect, int targetPlayer) {
         return false;
     }
     
-    // Get observers before applying effect (to re-attach after)
-    auto observers = opponent->getObservers();
-    
     // Parse effect command
     std::istringstream iss(effect);
     std::string effectType;
     iss >> effectType;
     
-    std::shared_ptr<Player> newOpponent;
-    
-    // Apply new effect by wrapping the existing opponent (which may already have effects)
-    // This allows effects to accumulate cumulatively
+    // Effects accumulate on the opponent until the game is restarted
     if (effectType == "blind") {
-        // Apply BlindEffect by wrapping existing opponent
-        newOpponent = std::make_shared<BlindEffect>(opponent);
+        opponent->applyBlind();
     } else if (effectType == "heavy") {
-        // Apply HeavyEffect by wrapping existing opponent
-        newOpponent = std::make_shared<HeavyEffect>(opponent);
+        opponent->applyHeavy();
     } else if (effectType == "force") {
         // Get block type
         std::string blockTypeStr;
@@ -214,8 +213,7 @@ bool Game::applySpecialEffect(const std::string& effect, int targetPlayer) {
                 std::cout << "Invalid block type: '" << blockType << "'. Valid types are: I, J, L, O, S, T, Z" << std::endl;
                 return false;
             }
-            // Apply ForceEffect by wrapping existing opponent
-            newOpponent = std::make_shared<ForceEffect>(opponent, blockType);
+            opponent->applyForce(blockType);
         } else {
             std::cout << "Invalid force command. Please specify a block type: force <blockType>" << std::endl;
             std::cout << "Valid block types are: I, J, L, O, S, T, Z" << std::endl;
@@ -232,25 +230,6 @@ bool Game::applySpecialEffect(const std::string& effect, int targetPlayer) {
         return false;
     }
     
-    // Replace target player with decorated version
-    if (targetPlayer == 0) {
-        // Use current to determine opponent
-        if (current == 1) {
-            p2 = newOpponent;
-        } else {
-            p1 = newOpponent;
-        }
-    } else if (targetPlayer == 1) {
-        p1 = newOpponent;
-    } else if (targetPlayer == 2) {
-        p2 = newOpponent;
-    }
-    
-    // Re-attach observers to the new decorated player
-    for (auto obs : observers) {
-        newOpponent->attach(obs);
-    }
-    
     // Note: canApplySpecial flag is reset in BasicPlayer::drop() 
     // when lastRowsCleared is set for the next drop
     return true;
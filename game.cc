@@ -10,8 +10,12 @@
 
 export module game;
 
+import <cstdint>;
 import <memory>;
 import <string>;
+import action;
+import basicplayer;
+import hint;
 import player;
 
 /**
@@ -29,9 +33,11 @@ import player;
  * and GraphicsObserver are attached to Board objects in main().
  */
 export class Game {
-    std::shared_ptr<Player> p1;  ///< Player 1 (ownership)
-    std::shared_ptr<Player> p2;  ///< Player 2 (ownership)
+    std::shared_ptr<BasicPlayer> p1;  ///< Player 1 (ownership)
+    std::shared_ptr<BasicPlayer> p2;  ///< Player 2 (ownership)
     int current = 1;             ///< Current player (1 or 2)
+    std::unique_ptr<Heuristic> heuristic;  ///< Scores placements for "hint"
+    HintFinder hintFinder;                 ///< Reusable placement search for "hint"
     
 public:
     /**
@@ -42,6 +48,16 @@ public:
      */
     Game();
     
+    /**
+     * @brief Seeds both players' block generators from one match seed
+     * @param seed Match seed; player N draws from stream N of it
+     * 
+     * Each player's blocks then depend only on the seed and the player's
+     * own moves, never on the other player or on other games. A new Game
+     * is seeded with 1.
+     */
+    void setSeed(std::uint64_t seed);
+    
     /**
      * @brief Starts the game
      * 
@@ -77,16 +93,23 @@ public:
     
     /**
      * @brief Executes a game command for the current player
-     * @param cmd The command string (e.g., "left", "right", "drop")
+     * @param command The parsed command (an Action converts to one)
      * @param multiplier Number of times to execute the command
      * @param droppingPlayerNum Output parameter: player number who dropped (1 or 2), set only if special effect should be applied
      * @param blockDropped Output parameter: set to true if a block was dropped (either via drop command or auto-drop)
      * @return true if a special effect should be applied (2+ rows cleared), false otherwise
      * 
      * This method handles all player actions. After actions that modify
-     * the board, the Board automatically notifies its observers.
+     * the board, the Board automatically notifies its observers. Text is
+     * parsed into a Command by CommandInterpreter::parseCommand.
+     */
+    bool handleCommand(Command command, int multiplier = 1, int* droppingPlayerNum = nullptr, bool* blockDropped = nullptr);
+    
+    /**
+     * @brief Replaces the heuristic used by the "hint" command
+     * @param h The new heuristic (a WeightedHeuristic by default)
      */
-    bool handleCommand(const std::string& cmd, int multiplier = 1, int* droppingPlayerNum = nullptr, bool* blockDropped = nullptr);
+    void setHeuristic(std::unique_ptr<Heuristic> h);
     
     /**
      * @brief Checks if the game has ended
@@ -109,8 +132,8 @@ public:
      * @return true if effect was successfully applied, false otherwise
      * 
      * This is called when a player clears 2+ rows and chooses a special effect.
-     * The effect is applied to the specified player using the decorator pattern.
-     * If the effect is invalid, outputs instructions and returns false.
+     * The effect is recorded on the specified player (see Player's special
+     * effects). If the effect is invalid, outputs instructions and returns false.
      */
     bool applySpecialEffect(const std::string& effect, int targetPlayer = 0);
     
@@ -8,8 +8,11 @@
 
 module graphicsobserver;
 
+import <bit>;
+import <cstdint>;
 import <memory>;
 import <sstream>;
+import subject;
 import textobserver;
 import player;
 import board;
@@ -23,7 +26,19 @@ GraphicsObserver::GraphicsObserver(Player* p1, Player* p2)
 }
 
 void GraphicsObserver::notify() {
-    draw();
+    if (!drawn || xw->wasExposed()) {
+        draw();
+        return;
+    }
+    
+    // Only what changed since the last notification
+    const Changes& changes1 = player1->getChanges();
+    const Changes& changes2 = player2->getChanges();
+    if ((changes1.panels | changes2.panels) & Changes::Stats) {
+        drawHighScore();
+    }
+    drawPlayer(*player1, 1, MARGIN, changes1);
+    drawPlayer(*player2, 2, MARGIN + PLAYER_SPACING, changes2);
 }
 
 int GraphicsObserver::getColorForSymbol(char sym) {
@@ -42,28 +57,21 @@ int GraphicsObserver::getColorForSymbol(char sym) {
 }
 
 void GraphicsObserver::draw() {
-    // Get all information from Player (Subject)
-    auto board1 = player1->getBoard();
-    auto board2 = player2->getBoard();
-    int level1 = player1->getLevel();
-    int level2 = player2->getLevel();
-    int score1 = player1->getScore();
-    int score2 = player2->getScore();
-    
-    auto curBlock1 = player1->getCurBlock();
-    auto curBlock2 = player2->getCurBlock();
-    Position curPos1 = player1->getCurPos();
-    Position curPos2 = player2->getCurPos();
-    
-    auto nextBlock1 = player1->getNextBlock();
-    auto nextBlock2 = player2->getNextBlock();
-    auto heldBlock1 = player1->getHeldBlock();
-    auto heldBlock2 = player2->getHeldBlock();
-    
     // Background - medium gray
     xw->fillRectangle(0, 0, 660, 850, XWindow::DarkGray);
     
+    drawHighScore();
+    
+    // Player 1 column (left), player 2 column (right)
+    drawPlayer(*player1, 1, MARGIN, Changes::all());
+    drawPlayer(*player2, 2, MARGIN + PLAYER_SPACING, Changes::all());
+    drawn = true;
+}
+
+void GraphicsObserver::drawHighScore() {
     // High Score bar at top center
+    int score1 = player1->getScore();
+    int score2 = player2->getScore();
     int highScore = (score1 > score2) ? score1 : score2;
     int highScoreWidth = 290;
     int highScoreX = (660 - highScoreWidth) / 2;
@@ -72,20 +80,24 @@ void GraphicsObserver::draw() {
     std::ostringstream ossHigh;
     ossHigh << "High Score:        " << highScore;
     xw->drawString(highScoreX + 60, 32, ossHigh.str(), XWindow::Black);
-    
-    // Player 1 column (left)
-    int p1X = MARGIN;
-    drawInfoBox(p1X, 60, 1, level1, score1);
-    drawBoard(board1.get(), p1X, 130, curBlock1.get(), curPos1);
-    drawNextBlockBox(p1X, 130 + BOARD_HEIGHT + 10, nextBlock1.get());
-    drawHeldBlockBox(p1X, 130 + BOARD_HEIGHT + 120, heldBlock1.get());
-    
-    // Player 2 column (right)
-    int p2X = MARGIN + PLAYER_SPACING;
-    drawInfoBox(p2X, 60, 2, level2, score2);
-    drawBoard(board2.get(), p2X, 130, curBlock2.get(), curPos2);
-    drawNextBlockBox(p2X, 130 + BOARD_HEIGHT + 10, nextBlock2.get());
-    drawHeldBlockBox(p2X, 130 + BOARD_HEIGHT + 120, heldBlock2.get());
+}
+
+void GraphicsObserver::drawPlayer(Player& player, int playerNum, int x, const Changes& changes) {
+    // Get all information from Player (Subject)
+    if (changes.panels & Changes::Stats) {
+        drawInfoBox(x, 60, playerNum, player.getLevel(), player.getScore());
+    }
+    if (changes.rows) {
+        drawBoard(player.getBoard().get(), x, 130, changes.rows,
+                  player.getCurBlock(), player.getCurPos(),
+                  player.getHintBlock(), player.getHintPos());
+    }
+    if (changes.panels & Changes::Next) {
+        drawNextBlockBox(x, 130 + BOARD_HEIGHT + 10, player.getNextBlock());
+    }
+    if (changes.panels & Changes::Held) {
+        drawHeldBlockBox(x, 130 + BOARD_HEIGHT + 120, player.getHeldBlock());
+    }
 }
 
 void GraphicsObserver::drawInfoBox(int x, int y, int playerNum, int level, int score) {
@@ -114,7 +126,7 @@ void GraphicsObserver::drawInfoBox(int x, int y, int playerNum, int level, int s
     xw->drawString(x + 150, y + 42, ossS.str(), XWindow::Black);
 }
 
-void GraphicsObserver::drawNextBlockBox(int x, int y, Block* nextBlock) {
+void GraphicsObserver::drawNextBlockBox(int x, int y, const Block* nextBlock) {
     // Draw box - light gray background with dark border
     xw->fillRectangle(x, y, INFO_BOX_WIDTH, 95, XWindow::LightGray);
     xw->drawRectangle(x, y, INFO_BOX_WIDTH, 95, XWindow::Black);
@@ -160,7 +172,7 @@ void GraphicsObserver::drawNextBlockBox(int x, int y, Block* nextBlock) {
     }
 }
 
-void GraphicsObserver::drawHeldBlockBox(int x, int y, Block* heldBlock) {
+void GraphicsObserver::drawHeldBlockBox(int x, int y, const Block* heldBlock) {
     // Draw box - light gray background with dark border
     xw->fillRectangle(x, y, INFO_BOX_WIDTH, 95, XWindow::LightGray);
     xw->drawRectangle(x, y, INFO_BOX_WIDTH, 95, XWindow::Black);
@@ -206,11 +218,29 @@ void GraphicsObserver::drawHeldBlockBox(int x, int y, Block* heldBlock) {
     }
 }
 
-void GraphicsObserver::drawBoard(Board* board, int offsetX, int offsetY,
-                                  Block* curBlock, const Position& curPos) {
+void GraphicsObserver::drawBoard(Board* board, int offsetX, int offsetY, std::uint64_t rows,
+                                  const Block* curBlock, const Position& curPos,
+                                  const Block* hintBlock, const Position& hintPos) {
     // Calculate cell size to fit board width exactly to match info box width
     int cellW = BOARD_WIDTH / board->getCols();  
     int cellH = BOARD_HEIGHT / board->getRows();
+    int numRows = board->getRows();
+    
+    // Cell outlines are one pixel larger than the cell, so a row also draws
+    // the top line of the row below: repaint every band from the first
+    // changed row to the one below the last, drawing each row that reaches it
+    int first = 0, last = numRows - 1;
+    if (rows != Changes::ALL_ROWS) {
+        std::uint64_t bands = (rows | rows << 1) & Changes::rowRange(0, numRows - 1);
+        if (!bands) return;
+        first = std::countr_zero(bands);
+        last = 63 - std::countl_zero(bands);
+        int top = offsetY + first * cellH;
+        int bottom = last == numRows - 1 ? offsetY + BOARD_HEIGHT : offsetY + (last + 1) * cellH;
+        xw->setClip(offsetX, top, BOARD_WIDTH + 1, bottom - top);
+        xw->fillRectangle(offsetX + BOARD_WIDTH, top, 1, bottom - top, XWindow::DarkGray);
+    }
+    auto changed = [first, last](int r) { return r >= first - 1 && r <= last; };
     
     // Draw board background with light gray color
     xw->fillRectangle(offsetX, offsetY, BOARD_WIDTH, BOARD_HEIGHT, XWindow::LightGray);
@@ -221,6 +251,7 @@ void GraphicsObserver::drawBoard(Board* board, int offsetX, int offsetY,
     
     // Draw placed cells from board
     for (int r = 0; r < board->getRows(); ++r) {
+        if (!changed(r)) continue;
         for (int c = 0; c < board->getCols(); ++c) {
             char sym = board->getCell(r, c);
             int x = offsetX + c * cellW;
@@ -247,11 +278,9 @@ void GraphicsObserver::drawBoard(Board* board, int offsetX, int offsetY,
     
     // Draw phantom block (where the block will land) - only if enabled
     if (curBlock && showPhantom) {
-        // Calculate phantom position by moving block down until it can't go further
+        // Calculate phantom position from the board's column heights
         Position phantomPos = curPos;
-        while (board->canPlace(*curBlock, Position{phantomPos.row + 1, phantomPos.col})) {
-            phantomPos.row++;
-        }
+        phantomPos.row += board->dropDistance(*curBlock, curPos);
         
         // Only draw phantom if it's not at the same position as current block
         if (phantomPos.row != curPos.row) {
@@ -259,7 +288,7 @@ void GraphicsObserver::drawBoard(Board* board, int offsetX, int offsetY,
                 int r = phantomPos.row + cell.row;
                 int c = phantomPos.col + cell.col;
                 
-                if (r >= 0 && r < board->getRows() && c >= 0 && c < board->getCols()) {
+                if (r >= 0 && r < board->getRows() && c >= 0 && c < board->getCols() && changed(r)) {
                     // Check if this cell is in the blind area (should not be visible)
                     if (board->getCell(r, c) == '?') {
                         // Skip drawing phantom block in blind area
@@ -278,13 +307,33 @@ void GraphicsObserver::drawBoard(Board* board, int offsetX, int offsetY,
         }
     }
     
+    // Draw hint (suggested placement) as cells outlined in the block color and
+    // labelled with its lowercase symbol ('?' already marks blinded cells)
+    if (hintBlock) {
+        const char label[] = {static_cast<char>(hintBlock->getSymbol() - 'A' + 'a'), '\0'};
+        for (const auto& cell : hintBlock->getCells()) {
+            int r = hintPos.row + cell.row;
+            int c = hintPos.col + cell.col;
+            
+            if (r >= 0 && r < board->getRows() && c >= 0 && c < board->getCols() && changed(r)) {
+                int x = offsetX + c * cellW;
+                int y = offsetY + r * cellH;
+                
+                xw->fillRectangle(x + 1, y + 1, cellW - 2, cellH - 2, XWindow::White);
+                xw->drawRectangle(x, y, cellW, cellH, getColorForSymbol(hintBlock->getSymbol()));
+                xw->drawString(x + cellW / 2 - 4, y + cellH / 2 + 4, label,
+                               getColorForSymbol(hintBlock->getSymbol()));
+            }
+        }
+    }
+    
     // Draw current active block on top
     if (curBlock) {
         for (const auto& cell : curBlock->getCells()) {
             int r = curPos.row + cell.row;
             int c = curPos.col + cell.col;
             
-            if (r >= 0 && r < board->getRows() && c >= 0 && c < board->getCols()) {
+            if (r >= 0 && r < board->getRows() && c >= 0 && c < board->getCols() && changed(r)) {
                 // Check if this cell is in the blind area (should not be visible)
                 if (board->getCell(r, c) == '?') {
                     // Skip drawing current block in blind area
@@ -300,6 +349,10 @@ void GraphicsObserver::drawBoard(Board* board, int offsetX, int offsetY,
             }
         }
     }
+    
+    if (rows != Changes::ALL_ROWS) {
+        xw->clearClip();
+    }
 }
 
 XWindow* GraphicsObserver::getXWindow() {
@@ -311,6 +364,8 @@ void GraphicsObserver::togglePhantom() {
 }
 
 void GraphicsObserver::showGameOver(int winner) {
+    drawn = false;  // the box covers the boards
+    
     // Draw semi-transparent overlay effect
     for (int i = 0; i < 3; ++i) {
         xw->fillRectangle(60 + i, 220 + i, 540 - i*2, 180 - i*2, XWindow::Black);
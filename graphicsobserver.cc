@@ -4,7 +4,8 @@
  * 
  * This file defines the GraphicsObserver class, which implements the Observer
  * pattern to display the game state using a graphical window (XWindow).
- * It observes two game boards and updates the display whenever notified.
+ * It observes two game boards and updates the display whenever notified,
+ * redrawing only the board rows and panels that changed.
  */
 
 export module graphicsobserver;
@@ -14,7 +15,9 @@ import player;
 import board;
 import block;
 import position;
+import subject;
 import xwindow;
+import <cstdint>;
 import <memory>;
 
 /**
@@ -44,6 +47,10 @@ export class GraphicsObserver : public TextObserver {
     // Flag to control phantom block display
     bool showPhantom;
     
+    // false until the whole window is drawn, and again once the game over
+    // box covers it; notify() then redraws everything
+    bool drawn = false;
+    
     /**
      * @brief Maps a block symbol to its corresponding color
      * @param sym The character symbol representing a block type
@@ -52,15 +59,34 @@ export class GraphicsObserver : public TextObserver {
     int getColorForSymbol(char sym);
     
     /**
-     * @brief Draws a game board with its current and falling blocks
+     * @brief Draws the rows of a game board that changed, with its current
+     *        and falling blocks
      * @param board Pointer to the Board to render
      * @param offsetX X-coordinate for board placement
      * @param offsetY Y-coordinate for board placement
+     * @param rows Rows that changed (Changes::ALL_ROWS draws the frame too)
      * @param curBlock Pointer to the currently falling block (or nullptr)
      * @param curPos Position of the current block
+     * @param hintBlock Pointer to the hinted block (or nullptr if no hint)
+     * @param hintPos Position where the hinted block comes to rest
+     */
+    void drawBoard(Board* board, int offsetX, int offsetY, std::uint64_t rows,
+                   const Block* curBlock, const Position& curPos,
+                   const Block* hintBlock, const Position& hintPos);
+    
+    /**
+     * @brief Draws the parts of one player's column that changed
+     * @param player The player to draw
+     * @param playerNum Player number (1 or 2)
+     * @param x X-coordinate of the column
+     * @param changes What changed (Changes::all() draws the whole column)
      */
-    void drawBoard(Board* board, int offsetX, int offsetY,
-                   Block* curBlock, const Position& curPos);
+    void drawPlayer(Player& player, int playerNum, int x, const Changes& changes);
+    
+    /**
+     * @brief Draws the high score bar at the top of the window
+     */
+    void drawHighScore();
     
     /**
      * @brief Draws the player information box (level and score)
@@ -78,7 +104,7 @@ export class GraphicsObserver : public TextObserver {
      * @param y Y-coordinate of the box
      * @param nextBlock Pointer to the next block to display (or nullptr)
      */
-    void drawNextBlockBox(int x, int y, Block* nextBlock);
+    void drawNextBlockBox(int x, int y, const Block* nextBlock);
     
     /**
      * @brief Draws the "Held Block" preview box
@@ -86,7 +112,7 @@ export class GraphicsObserver : public TextObserver {
      * @param y Y-coordinate of the box
      * @param heldBlock Pointer to the held block to display (or nullptr)
      */
-    void drawHeldBlockBox(int x, int y, Block* heldBlock);
+    void drawHeldBlockBox(int x, int y, const Block* heldBlock);
     
 public:
     /**
@@ -99,8 +125,9 @@ public:
     /**
      * @brief Called when the observed subject changes state
      * 
-     * This method is part of the Observer pattern. It triggers a redraw
-     * of the entire game display.
+     * This method is part of the Observer pattern. It redraws what the
+     * players' getChanges() report, or the entire game display the first
+     * time, after the window was uncovered and after showGameOver().
      */
     void notify() override;
     
@@ -124,6 +151,9 @@ public:
     /**
      * @brief Displays "Game Over" message on the graphics window
      * @param winner Player number (1 or 2) or 0 for tie
+     * 
+     * The box covers both boards, so the next notification redraws the
+     * entire display.
      */
     void showGameOver(int winner = 0);
     
@@ -0,0 +1,75 @@
+// Hint module - implementation
+module hint;
+
+import <optional>;
+import <vector>;
+import action;
+import basicplayer;
+import block;
+import board;
+import movegen;
+import player;
+import position;
+
+double WeightedHeuristic::evaluate(const PlacementFeatures& features) const {
+    return heightWeight * features.aggregateHeight
+         + holeWeight * features.holes
+         + bumpinessWeight * features.bumpiness
+         + linesWeight * features.linesCleared
+         + scoreWeight * features.scoreDelta;
+}
+
+// Movement rules of a player: its level plus the heavy effects played on it
+static MoveRules rulesOf(const Player& player) {
+    MoveRules rules;
+    rules.level = player.getLevel();
+    rules.heavyEffects = player.getHeavyEffects();
+    return rules;
+}
+
+// Features of the board left after dropping block at pos
+static PlacementFeatures featuresOf(Board board, const Block& block, const Position& pos, int level) {
+    PlacementFeatures features;
+    board.place(block, pos);
+    auto result = board.clearFullRowsWithBlockInfo();
+    features.linesCleared = result.rowsCleared;
+    features.scoreDelta = BasicPlayer::clearScore(level, result);
+    features.holes = board.countHoles();
+
+    int previous = board.getColumnHeight(0);
+    features.aggregateHeight = previous;
+    for (int c = 1; c < Board::getCols(); ++c) {
+        int height = board.getColumnHeight(c);
+        features.aggregateHeight += height;
+        features.bumpiness += height > previous ? height - previous : previous - height;
+        previous = height;
+    }
+    return features;
+}
+
+std::optional<Hint> HintFinder::find(Player& player, const Heuristic& heuristic) {
+    const Block* current = player.getCurBlock();
+    if (!current) return std::nullopt;
+
+    const Board& board = *player.getBoard();
+    const auto& placements = generator.generate(board, *current, player.getCurPos(), rulesOf(player));
+
+    std::optional<Hint> best;
+    int bestIndex = 0;
+    Block rotated = *current;
+    for (int i = 0; i < static_cast<int>(placements.size()); ++i) {
+        const Placement& placement = placements[i];
+        while (rotated.getRotation() != placement.rotation) rotated.rotateCW();
+
+        PlacementFeatures features = featuresOf(board, rotated, placement.pos, player.getLevel());
+        double value = heuristic.evaluate(features);
+        // Placements come shortest first, so ties keep the fewest commands
+        if (!best || value > best->value) {
+            best = Hint{rotated, placement.pos, {}, features, value};
+            bestIndex = i;
+        }
+    }
+
+    if (best) best->commands = generator.commandsFor(bestIndex);
+    return best;
+}
@@ -0,0 +1,108 @@
+/**
+ * @file hint.cc
+ * @brief Interface for the hint search (placement evaluation)
+ *
+ * This file defines what the `hint` command needs: the features of a board
+ * after a placement, the Heuristic interface that scores them, a default
+ * weighted heuristic, and HintFinder, which evaluates every placement the
+ * MoveGenerator reports and picks the best one.
+ */
+
+export module hint;
+
+import <optional>;
+import <vector>;
+import action;
+import block;
+import movegen;
+import player;
+import position;
+
+/**
+ * @struct PlacementFeatures
+ * @brief Board features after the current block is dropped somewhere
+ *
+ * Measured after full rows are cleared, so they describe the board the
+ * player is left with.
+ */
+export struct PlacementFeatures {
+    int aggregateHeight = 0;    ///< Sum of the column heights
+    int holes = 0;              ///< Empty cells with a filled cell above them
+    int bumpiness = 0;          ///< Sum of height differences of neighbouring columns
+    int linesCleared = 0;       ///< Rows the drop clears
+    int scoreDelta = 0;         ///< Points the drop scores
+};
+
+/**
+ * @class Heuristic
+ * @brief Scores a placement from its features (higher is better)
+ *
+ * Implement this to plug a different evaluation into HintFinder (and
+ * Game::setHeuristic()).
+ */
+export class Heuristic {
+public:
+    virtual ~Heuristic() = default;
+
+    /**
+     * @brief Scores the board a placement leaves behind
+     * @param features Features of the board after the drop
+     * @return Value of the placement; the highest value is suggested
+     */
+    virtual double evaluate(const PlacementFeatures& features) const = 0;
+};
+
+/**
+ * @class WeightedHeuristic
+ * @brief Linear combination of the placement features
+ *
+ * The default weights favour low, flat boards without holes and reward
+ * clearing rows.
+ */
+export class WeightedHeuristic : public Heuristic {
+public:
+    double heightWeight = -0.51;
+    double holeWeight = -0.36;
+    double bumpinessWeight = -0.18;
+    double linesWeight = 0.76;
+    double scoreWeight = 0.01;
+
+    double evaluate(const PlacementFeatures& features) const override;
+};
+
+/**
+ * @struct Hint
+ * @brief The best placement found for a player's current block
+ */
+export struct Hint {
+    Block block;                    ///< Current block in the suggested rotation
+    Position pos;                   ///< Where the block comes to rest
+    std::vector<Action> commands;   ///< Shortest commands that get it there (ending with drop)
+    PlacementFeatures features;     ///< Features of the resulting board
+    double value = 0;               ///< Heuristic value of the placement
+};
+
+/**
+ * @class HintFinder
+ * @brief Finds the best placement of a player's current block
+ *
+ * Every placement reachable under the player's level and heavy effects is
+ * dropped on a copy of the board (a fixed-size value, so no allocation) and
+ * scored with the heuristic. Column heights and holes come straight from
+ * the board's column masks, so a full search takes microseconds.
+ *
+ * Keep one finder and reuse it; it owns the move generator's buffers.
+ */
+export class HintFinder {
+    MoveGenerator generator;
+
+public:
+    /**
+     * @brief Finds the placement the heuristic likes best
+     * @param player The player whose current block is placed
+     * @param heuristic How to score the placements
+     * @return The best placement, or nothing if the player has no block
+     *         that can move
+     */
+    std::optional<Hint> find(Player& player, const Heuristic& heuristic);
+};
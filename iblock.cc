@@ -2,16 +2,12 @@
 export module iblock;
 
 import block;
-import position;
-import <vector>;
 
+/*
+ * IBlock:
+ * Selects the 'I' shape; rotation data lives in the shared SHAPES table.
+ */
 export class IBlock : public Block {
-    int rotation = 0;
-    
 public:
     IBlock(int id, int level);
-    void rotateCW() override;
-    void rotateCCW() override;
 };
-
-
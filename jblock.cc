@@ -3,13 +3,11 @@ export module jblock;
 
 import block;
 
+/*
+ * JBlock:
+ * Selects the 'J' shape; rotation data lives in the shared SHAPES table.
+ */
 export class JBlock : public Block {
-    int rotation = 0;
-    
 public:
     JBlock(int id, int level);
-    void rotateCW() override;
-    void rotateCCW() override;
 };
-
-
@@ -3,13 +3,11 @@ export module lblock;
 
 import block;
 
+/*
+ * LBlock:
+ * Selects the 'L' shape; rotation data lives in the shared SHAPES table.
+ */
 export class LBlock : public Block {
-    int rotation = 0;
-    
 public:
     LBlock(int id, int level);
-    void rotateCW() override;
-    void rotateCCW() override;
 };
-
-
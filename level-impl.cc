@@ -2,6 +2,9 @@
 
 module level;
 
+import block;
+import rng;
+
 
 Level::Level(int num) : levelNum{num} {}
 
@@ -9,4 +12,15 @@ Level::Level(int num) : levelNum{num} {}
 int Level::getLevelNum() const { return levelNum; }
 
 
+Block Level::generateBlock(int id, Rng &rng) {
+    return Block{id, generateBlock(rng), levelNum};
+}
+
+
 Level::~Level() {}
+
+
+LevelState Level::saveState() const { return LevelState{}; }
+
+
+void Level::restoreState(const LevelState &) {}
@@ -8,9 +8,29 @@
 
  export module level;
 
+ import <array>;
  import <memory>;
  import <string>;
  import block;
+ import rng;
+ 
+ /// Number of block types the random levels draw per batch
+ export inline constexpr int BLOCK_LOOKAHEAD = 8;
+ 
+ /**
+  * @struct LevelState
+  * @brief Plain-value copy of the mutable state of a Level
+  *
+  * Used by player snapshots. Which fields matter depends on the level:
+  * Level 0 uses the script cursor, Levels 1–4 use the random flag and the
+  * queue of block types already drawn.
+  */
+ export struct LevelState {
+     int cursor = 0;          ///< Level 0: index of the next scripted block
+     bool randomMode = true;  ///< Levels 1–4: whether randomness is enabled
+     int queued = 0;          ///< Levels 1–4: drawn types not yet handed out
+     std::array<char, BLOCK_LOOKAHEAD> lookahead{};  ///< Levels 1–4: the drawn types
+ };
  
  /**
   * @class Level
@@ -33,17 +53,26 @@
      /// Return the numeric level (0–4).
      int getLevelNum() const;
  
-     /// Create a new Block with the given ID.
-     virtual std::shared_ptr<Block> generateBlock(int id) = 0;
+     /// Create a new Block with the given ID, of the next generated type.
+     /// Blocks are small values built on the shared shape table, so this
+     /// never allocates.
+     Block generateBlock(int id, Rng &rng);
  
      /// Return just the block type character ('I','J','L','O','S','T','Z').
-     virtual char generateBlock() = 0;
+     /// Random levels draw from rng, the generator of the owning player.
+     virtual char generateBlock(Rng &rng) = 0;
  
      /// Turn randomness on/off for levels that support it.
      virtual void setRandom(bool random) = 0;
  
      /// Set a script file for scripted levels (e.g., Level 0).
      virtual void setScriptFile(const std::string &filename) = 0;
+ 
+     /// Capture the level's mutable state (default: nothing to save).
+     virtual LevelState saveState() const;
+ 
+     /// Restore state captured by saveState() on a level of the same kind.
+     virtual void restoreState(const LevelState &state);
  };
  
 
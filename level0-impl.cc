@@ -3,70 +3,20 @@ module level0;
 
 import level;
 import block;
-import iblock;
-import jblock;
-import lblock;
-import oblock;
-import sblock;
-import tblock;
-import zblock;
+import rng;
+import sequencetable;
 import <memory>;
 import <string>;
-import <fstream>;
-import <vector>;
 
 
 
-Level0::Level0() : Level{0}, scriptFile{"sequence.txt"} {
-    loadSequence();
-}
-
+Level0::Level0() : Level{0}, sequence{SequenceTable::load("sequence.txt")} {}
 
-void Level0::loadSequence() {
-    sequence.clear();
-    std::ifstream file{scriptFile};
-    char c;
-    while (file >> c) {
-        sequence.push_back(c);
-    }
-    currentIndex = 0;
-}
 
-
-std::shared_ptr<Block> Level0::generateBlock(int id) {
-    char type = generateBlock();  // obtain next scripted type
-
-    if (type == 'I') {
-        return std::make_shared<IBlock>(id, levelNum);
-    }
-    else if (type == 'J') {
-        return std::make_shared<JBlock>(id, levelNum);
-    }
-    else if (type == 'L') {
-        return std::make_shared<LBlock>(id, levelNum);
-    }
-    else if (type == 'O') {
-        return std::make_shared<OBlock>(id, levelNum);
-    }
-    else if (type == 'S') {
-        return std::make_shared<SBlock>(id, levelNum);
-    }
-    else if (type == 'T') {
-        return std::make_shared<TBlock>(id, levelNum);
-    }
-    else if (type == 'Z') {
-        return std::make_shared<ZBlock>(id, levelNum);
-    }
-    else {
-        // fallback to I-block if invalid character appears
-        return std::make_shared<IBlock>(id, levelNum);
-    }
-}
-
-char Level0::generateBlock() {
-    if (sequence.empty()) return 'I';
-    char type = sequence[currentIndex];
-    currentIndex = (currentIndex + 1) % sequence.size();
+char Level0::generateBlock(Rng &) {
+    if (sequence->empty()) return 'I';
+    char type = sequence->at(currentIndex);
+    currentIndex = (currentIndex + 1) % sequence->size();
     return type;
 }
 
@@ -76,8 +26,18 @@ void Level0::setRandom(bool random) {
 
 
 void Level0::setScriptFile(const std::string& filename) {
-    scriptFile = filename;
-    loadSequence();
+    sequence = SequenceTable::load(filename);
+    currentIndex = 0;
+}
+
+
+LevelState Level0::saveState() const {
+    LevelState state;
+    state.cursor = currentIndex;
+    return state;
 }
 
 
+void Level0::restoreState(const LevelState& state) {
+    currentIndex = sequence->empty() ? 0 : state.cursor % sequence->size();
+}
@@ -3,9 +3,10 @@ export module level0;
 
 import level;
 import block;
+import rng;
+import sequencetable;
 import <memory>;
 import <string>;
-import <vector>;
 
 /*
  * Level0:
@@ -16,40 +17,25 @@ import <vector>;
  * sequence of block types from a script file (default "sequence.txt")
  * and cycles through them repeatedly.  This is used for testing and for
  * deterministic gameplay behaviour.
+ *
+ * The parsed script is a SequenceTable shared by every Level0 using the
+ * same file; a Level0 only owns its cursor.  Characters are used exactly
+ * as stored in the file.  If the file is empty, Level0 defaults to
+ * producing 'I'.
  */
 export class Level0 : public Level {
-    std::string scriptFile;     // Path to the script file containing block types
-    std::vector<char> sequence; // Sequence of block types read from file
-    int currentIndex = 0;       // Current position in sequence
-    
-    /*
-     * loadSequence():
-     * ----------------
-     * Reads characters from scriptFile and fills the sequence vector.
-     * Valid block types are I,J,L,O,S,T,Z.  Characters are consumed
-     * exactly as stored in the file.  If the file is empty, Level0
-     * defaults to producing 'I'.
-     */
-    void loadSequence();
+    std::shared_ptr<const SequenceTable> sequence; // Shared, parsed script
+    int currentIndex = 0;                          // Current position in sequence
     
 public:
     Level0();
-    
-    /*
-     * generateBlock(int id):
-     * -----------------------
-     * Creates and returns a Block object using the next block type
-     * from the sequence.  Wraps around to the start of the sequence
-     * when the end is reached.
-     */
-    std::shared_ptr<Block> generateBlock(int id) override;
 
     /*
      * generateBlock():
      * ----------------
      * Returns the next block type character from the sequence.
      */
-    char generateBlock() override;
+    char generateBlock(Rng &rng) override;
 
     /*
      * setRandom(bool):
@@ -61,9 +47,19 @@ public:
     /*
      * setScriptFile(const std::string&):
      * -----------------------------------
-     * Updates the script file path and reloads the sequence from disk.
+     * Switches to the script file's shared table (parsed on first use)
+     * and restarts from its first block.
      */
     void setScriptFile(const std::string& filename) override;
+
+    /*
+     * saveState() / restoreState():
+     * -----------------------------
+     * Save and restore the position in the sequence.  The sequence
+     * itself comes from the script file and is not part of the state.
+     */
+    LevelState saveState() const override;
+    void restoreState(const LevelState& state) override;
 };
 
 
@@ -3,9 +3,11 @@ import <string>;
 import <sstream>;
 import <memory>;
 import <cstdlib>;
+import action;
 import game;
 import commandinterpreter;
 import position;
+import subject;
 import textobserver;
 import graphicsobserver;
 
@@ -17,6 +19,7 @@ int main(int argc, char* argv[]) {
         string scriptFile2 = "biquadris_sequence2.txt";
         int startLevel = 0;
         bool textOnly = false;
+        bool ansi = false;  // Redraw only changed cells of the text display
         unsigned int seed = 0;
         bool useSeed = false;
         bool enableStdin = false;  // Enable stdin input in graphics mode
@@ -25,6 +28,8 @@ int main(int argc, char* argv[]) {
             string arg = argv[i];
             if (arg == "-text") {
                 textOnly = true;
+            } else if (arg == "-ansi") {
+                ansi = true;
             } else if (arg == "-seed" && i + 1 < argc) {
                 seed = stoi(argv[++i]);
                 useSeed = true;
@@ -41,14 +46,14 @@ int main(int argc, char* argv[]) {
             }
         }
         
+        // Create game (manages players only)
+        auto game = make_shared<Game>();
+        
         // Set random seed if specified
         if (useSeed) {
-            srand(seed);
+            game->setSeed(seed);
         }
         
-        // Create game (manages players only)
-        auto game = make_shared<Game>();
-        
         // Set start levels and script files for players
         for (int i = 0; i < startLevel; ++i) {
             game->getPlayer1()->levelUp();
@@ -67,7 +72,8 @@ int main(int argc, char* argv[]) {
         // Observer observes Player (Subject) and gets all information from Player
         auto textObs = make_shared<TextObserver>(
             game->getPlayer1().get(),
-            game->getPlayer2().get()
+            game->getPlayer2().get(),
+            ansi
         );
         game->getPlayer1()->attach(textObs.get());
         game->getPlayer2()->attach(textObs.get());
@@ -175,27 +181,30 @@ int main(int argc, char* argv[]) {
                 }
             }
             
-            // Match abbreviated command to full command
-            cmd = CommandInterpreter::matchCommand(cmd);
+            // Match abbreviated command and parse it; the game only sees the typed form
+            Command command = CommandInterpreter::parseCommand(cmd);
+            
+            // The players' notifications are batched: each command renders one frame
+            NotificationBatch frame{game->getPlayer1().get(), game->getPlayer2().get()};
             
             // Handle special commands that ignore multipliers
-            if (cmd == "restart" || cmd == "hint" || cmd == "norandom" || 
-                cmd == "random" || cmd == "sequence" || cmd == "phantom") {
-                if (cmd == "restart") {
+            if (command.type >= CommandType::Hint && command.type <= CommandType::Phantom) {
+                if (command.type == CommandType::Restart) {
                     game->restart();
                     cout << "Game restarted!" << endl;
-                } else if (cmd == "phantom") {
+                } else if (command.type == CommandType::Phantom) {
                     // Toggle phantom block display (graphics only)
                     if (graphicsObs) {
                         graphicsObs->togglePhantom();
-                        graphicsObs->notify();  // Update display
+                        // Redraw the current player's board in this command's frame
+                        game->getCurrentPlayer()->notifyObservers(Changes{Changes::ALL_ROWS, 0});
                         cout << "Phantom block display toggled." << endl;
                     } else {
                         cout << "Phantom command only works in graphics mode." << endl;
                     }
                 } else {
                     // Other special commands handled by game
-                    game->handleCommand(cmd, 1);
+                    game->handleCommand(command, 1);
                 }
             } else {
                 // Apply multiplier for regular commands
@@ -203,7 +212,7 @@ int main(int argc, char* argv[]) {
                 if (multiplier <= 0) multiplier = 1;
                 int droppingPlayer = 0;
                 bool blockDropped = false;
-                bool shouldApplySpecial = game->handleCommand(cmd, multiplier, &droppingPlayer, &blockDropped);
+                bool shouldApplySpecial = game->handleCommand(command, multiplier, &droppingPlayer, &blockDropped);
                 
                 // Handle turn switching and block spawning after a block is dropped
                 // This is the responsibility of main.cc, not handleCommand
@@ -218,7 +227,9 @@ int main(int argc, char* argv[]) {
                 
                 // Check if special effect should be applied after drop
                 // handleCommand returns true if 2+ rows were cleared
-                if (cmd == "drop" && shouldApplySpecial && droppingPlayer > 0) {
+                if (command.type == CommandType::Drop && shouldApplySpecial && droppingPlayer > 0) {
+                    frame.finish();  // show the drop before asking for the effect
+                    NotificationBatch effectFrame{game->getPlayer1().get(), game->getPlayer2().get()};
                     cout << "Special action available! You cleared 2+ rows." << endl;
                     
                     // Determine opponent: if droppingPlayer is 1, apply to 2; if 2, apply to 1
@@ -260,7 +271,9 @@ int main(int argc, char* argv[]) {
                 }
             }
             
-            // Check for game over before updating displays
+            frame.finish();
+            
+            // Check for game over after the final frame
             if (game->isGameOver()) {
                 cout << "Game Over!" << endl;
                 
@@ -286,15 +299,6 @@ int main(int argc, char* argv[]) {
                 // Don't update blocks after game over - wait for restart or quit
                 continue;
             }
-            
-            // Observer gets all info from Player (Subject) automatically
-            // Player will notify observers when state changes, but we can also
-            // manually trigger update after commands if needed
-            textObs->notify();  // Trigger text display update
-            
-            if (graphicsObs) {
-                graphicsObs->notify();  // Trigger graphics display update
-            }
         }
         
         cout << "Thanks for playing Biquadris!" << endl;
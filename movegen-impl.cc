@@ -0,0 +1,111 @@
+// MoveGenerator module - implementation
+module movegen;
+
+import <array>;
+import <algorithm>;
+import <cstdint>;
+import <vector>;
+import action;
+import board;
+import block;
+import position;
+
+// Lets a block fall up to `rows` rows, stopping where it lands
+static Position fall(const Board& board, const Block& block, Position pos, int rows) {
+    if (rows > 0) pos.row += std::min(rows, board.dropDistance(block, pos));
+    return pos;
+}
+
+const std::vector<Placement>& MoveGenerator::generate(const Board& board, const Block& block,
+                                                      const Position& start, const MoveRules& rules) {
+    parent.fill(NONE);
+    landing.fill(NONE);
+    placements.clear();
+    placementSource.clear();
+
+    if (!board.canPlace(block, start)) return placements;
+
+    // The block in each of its rotation states
+    int count = block.getRotationCount();
+    std::array<Block, ROTATIONS> rotated{block, block, block, block};
+    for (int r = 0; r < count; ++r) {
+        while (rotated[r].getRotation() != r) rotated[r].rotateCW();
+    }
+
+    // Rows a block falls after a successful left/right/rotate, and after a
+    // rotate that did not fit
+    int heavyRows = 2 * rules.heavyEffects;
+    int movedRows = (rules.level == 3 || rules.level == 4 ? 1 : 0) + heavyRows;
+
+    startState = stateIndex(block.getRotation(), start.row, start.col);
+    parent[startState] = static_cast<std::int16_t>(startState);
+    distance[startState] = 0;
+    queue[0] = static_cast<std::int16_t>(startState);
+    int head = 0;
+    int tail = 1;
+
+    while (head < tail) {
+        int s = queue[head++];
+        int r = s / (ROW_SPAN * COL_SPAN);
+        Position pos{(s / COL_SPAN) % ROW_SPAN - MARGIN, s % COL_SPAN - MARGIN};
+        const Block& cur = rotated[r];
+
+        // Hard drop from here
+        Position rest{pos.row + board.dropDistance(cur, pos), pos.col};
+        int restState = stateIndex(r, rest.row, rest.col);
+        if (landing[restState] == NONE) {
+            landing[restState] = static_cast<std::int16_t>(placements.size());
+            placements.push_back(Placement{rest, r, distance[s] + 1});
+            placementSource.push_back(static_cast<std::int16_t>(s));
+        }
+
+        // Expand every command the player could issue next
+        for (Action action : {Action::Left, Action::Right, Action::Down,
+                              Action::Clockwise, Action::CounterClockwise}) {
+            int nextRotation = r;
+            Position next = pos;
+
+            if (action == Action::Left || action == Action::Right) {
+                next.col += (action == Action::Left) ? -1 : 1;
+                if (!board.canPlace(cur, next)) continue;
+                next = fall(board, cur, next, movedRows);
+            } else if (action == Action::Down) {
+                next = fall(board, cur, next, 1);
+            } else {
+                bool clockwise = (action == Action::Clockwise);
+                nextRotation = clockwise ? (r + 1) % count : (r + count - 1) % count;
+                next = pos + cur.getRotationShift(clockwise);
+                if (board.canPlace(rotated[nextRotation], next)) {
+                    next = fall(board, rotated[nextRotation], next, movedRows);
+                } else {
+                    // Rotation undone; heavy effects still pull the block down
+                    nextRotation = r;
+                    next = fall(board, cur, pos, heavyRows);
+                }
+            }
+
+            int n = stateIndex(nextRotation, next.row, next.col);
+            if (parent[n] != NONE) continue;
+            parent[n] = static_cast<std::int16_t>(s);
+            distance[n] = static_cast<std::int16_t>(distance[s] + 1);
+            via[n] = action;
+            queue[tail++] = static_cast<std::int16_t>(n);
+        }
+    }
+
+    return placements;
+}
+
+const std::vector<Placement>& MoveGenerator::getPlacements() const {
+    return placements;
+}
+
+std::vector<Action> MoveGenerator::commandsFor(int index) const {
+    std::vector<Action> commands;
+    for (int s = placementSource[index]; s != startState; s = parent[s]) {
+        commands.push_back(via[s]);
+    }
+    std::reverse(commands.begin(), commands.end());
+    commands.push_back(Action::Drop);
+    return commands;
+}
@@ -0,0 +1,107 @@
+/**
+ * @file movegen.cc
+ * @brief Interface for the MoveGenerator class (reachable placements)
+ *
+ * This file defines the MoveGenerator class, which answers "where can the
+ * current block end up?" by searching the block's reachable states with the
+ * same movement and rotation rules BasicPlayer applies, and reports every
+ * distinct resting placement together with its shortest command sequence.
+ */
+
+export module movegen;
+
+import <array>;
+import <cstdint>;
+import <vector>;
+import action;
+import board;
+import block;
+import position;
+
+/**
+ * @struct MoveRules
+ * @brief The parts of a player's state that change how blocks move
+ */
+export struct MoveRules {
+    int level = 0;          ///< Player level; at 3 and 4 blocks fall 1 row after a move/rotate
+    int heavyEffects = 0;   ///< Stacked heavy effects; each adds 2 rows after a move/rotate
+};
+
+/**
+ * @struct Placement
+ * @brief A distinct resting place of a block after a drop
+ */
+export struct Placement {
+    Position pos;       ///< Block origin where it comes to rest
+    int rotation;       ///< Rotation state at rest
+    int commands;       ///< Length of the shortest command sequence, including the drop
+};
+
+/**
+ * @class MoveGenerator
+ * @brief Enumerates every resting placement reachable from a start state
+ *
+ * A breadth-first search over (rotation, row, column) states. Each state
+ * expands with left, right, down, cw and ccw exactly as BasicPlayer (with
+ * its heavy effects) would apply them:
+ * - rotations keep the lower-left corner of the bounding box fixed and are
+ *   undone if the rotated block does not fit
+ * - at levels 3 and 4 a successful left/right/rotate is followed by one
+ *   row down if possible
+ * - each heavy effect adds two more rows down after a successful left/right
+ *   and after every rotate, even one that did not fit
+ *
+ * Every reached state is then hard-dropped. Because states are visited in
+ * order of distance, the first state to land on a placement gives its
+ * shortest command sequence, and placements come out shortest first.
+ *
+ * A generator reuses its buffers, so keep one per thread and call
+ * generate() repeatedly.
+ */
+export class MoveGenerator {
+public:
+    /**
+     * @brief Finds all placements reachable from a start state
+     * @param board The board the block moves on
+     * @param block The block (in its current rotation)
+     * @param start The block's current origin
+     * @param rules Level and heavy effects of the player
+     * @return The placements, valid until the next call (none if the block
+     *         does not fit at start)
+     */
+    const std::vector<Placement>& generate(const Board& board, const Block& block,
+                                           const Position& start, const MoveRules& rules = {});
+
+    /**
+     * @brief Gets the placements found by the last generate()
+     */
+    const std::vector<Placement>& getPlacements() const;
+
+    /**
+     * @brief Gets the shortest command sequence for a placement
+     * @param index Index into the placements of the last generate()
+     * @return Commands from the start state, ending with Action::Drop
+     */
+    std::vector<Action> commandsFor(int index) const;
+
+private:
+    static constexpr int ROTATIONS = 4;
+    static constexpr int MARGIN = 2;    ///< Origins may sit up to 2 columns/rows outside the board
+    static constexpr int ROW_SPAN = Board::getRows() + MARGIN;
+    static constexpr int COL_SPAN = Board::getCols() + MARGIN;
+    static constexpr int STATES = ROTATIONS * ROW_SPAN * COL_SPAN;
+    static constexpr std::int16_t NONE = -1;
+
+    std::array<std::int16_t, STATES> parent{};     ///< Previous state on a shortest path (NONE = unvisited)
+    std::array<std::int16_t, STATES> distance{};   ///< Commands needed to reach each state
+    std::array<Action, STATES> via{};              ///< Action that reached each state
+    std::array<std::int16_t, STATES> queue{};      ///< BFS queue of state indices
+    std::array<std::int16_t, STATES> landing{};    ///< Placement index of each resting state
+    std::vector<Placement> placements;             ///< Results of the last generate()
+    std::vector<std::int16_t> placementSource;     ///< State each placement is dropped from
+    int startState = 0;                            ///< State generate() started from
+
+    static constexpr int stateIndex(int rotation, int row, int col) {
+        return (rotation * ROW_SPAN + row + MARGIN) * COL_SPAN + col + MARGIN;
+    }
+};
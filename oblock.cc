@@ -3,11 +3,11 @@ export module oblock;
 
 import block;
 
+/*
+ * OBlock:
+ * Selects the 'O' shape; rotation data lives in the shared SHAPES table.
+ */
 export class OBlock : public Block {
 public:
     OBlock(int id, int level);
-    void rotateCW() override;
-    void rotateCCW() override;
 };
-
-
@@ -5,10 +5,106 @@
  * This file defines the abstract Observer interface, which is the core
  * of the Observer design pattern. Observers implement the notify() method
  * to respond to changes in subjects they are observing.
+ * 
+ * Subjects also publish typed events describing each change as it happens
+ * (a piece spawned or moved, rows cleared, ...). From a player's reset on,
+ * the events are enough to follow its pieces, score and level, so stats
+ * collectors and replay recorders can consume the stream without
+ * re-reading the subject's state. Displays redraw the regions a
+ * notification reports changed instead (Subject::getChanges()), since
+ * those also cover the phantom and hint overlays.
  */
 
 export module observer;
 
+import <cstdint>;
+import <variant>;
+import position;
+
+/// A new current block entered the board at its spawn position (a
+/// NextChanged for the block after it follows)
+export struct PieceSpawned {
+    char type;     ///< Type of the new current block
+    Position pos;  ///< Origin it spawned at
+};
+
+/// The next block changed (generated, regenerated by a level change, or forced)
+export struct NextChanged {
+    char next;  ///< Type of the new next block
+};
+
+/// The current block was replaced by another type at the spawn position
+/// (the I, J, L, ... testing commands and force)
+export struct PieceReplaced {
+    char type;     ///< Type of the new current block
+    Position pos;  ///< Origin it was placed at
+};
+
+/// The current block was held (a PieceSpawned follows the first hold)
+export struct PieceHeld {
+    char held;     ///< Type of the block now held
+    char current;  ///< Type of the current block after a swap (0 on the first hold)
+    int rotation;  ///< Rotation it was held in (see Block::getRotation())
+    Position pos;  ///< Origin of the current block after a swap
+};
+
+/// The current block moved (left/right/down, including any fall it caused)
+export struct PieceMoved {
+    Position from;  ///< Origin before the move
+    Position to;    ///< Origin after the move
+};
+
+/// The current block rotated (to includes any fall the rotation caused)
+export struct PieceRotated {
+    bool clockwise;  ///< Direction of the rotation
+    Position from;   ///< Origin before the rotation
+    Position to;     ///< Origin after the rotation
+};
+
+/// A block was placed on the board (a dropped block, or Level 4's '*')
+export struct BlockPlaced {
+    char type;     ///< Block type ('I', 'J', ..., or '*')
+    Position pos;  ///< Origin it landed at
+};
+
+/// Full rows were cleared by a drop
+export struct RowsCleared {
+    int rows;  ///< Number of rows cleared
+};
+
+/// The score changed
+export struct ScoreChanged {
+    int score;   ///< New score
+    int points;  ///< Points just scored (0 when the score was reset)
+};
+
+/// The level changed
+export struct LevelChanged {
+    int level;  ///< New level (0-4)
+};
+
+/// Special effect kinds
+export enum class EffectKind : std::uint8_t { Blind, Heavy, Force };
+
+/// A special effect was played on the subject
+export struct EffectApplied {
+    EffectKind effect;  ///< Which effect
+    char block;         ///< Forced block type (EffectKind::Force only)
+};
+
+/// The player was reset for a new game: empty board, no blocks, no effects
+/// (ScoreChanged, LevelChanged and NextChanged follow as needed)
+export struct PlayerReset {};
+
+/// The player lost (a block did not fit at the spawn position)
+export struct PlayerLost {};
+
+/// Any event a subject publishes
+export using Event = std::variant<PieceSpawned, NextChanged, PieceReplaced, PieceHeld,
+                                  PieceMoved, PieceRotated, BlockPlaced, RowsCleared,
+                                  ScoreChanged, LevelChanged, EffectApplied,
+                                  PlayerReset, PlayerLost>;
+
 /**
  * @class Observer
  * @brief Abstract interface for objects that observe subjects
@@ -34,8 +130,20 @@ public:
      * This method must be implemented by all concrete observer classes.
      * It is called by the subject when notifyObservers() is invoked,
      * allowing the observer to update its display or internal state.
+     * While it runs, the subject's getChanges() says which regions changed.
      */
     virtual void notify() = 0;
+    
+    /**
+     * @brief Called when the subject publishes an event
+     * @param event What changed
+     * 
+     * Events are delivered as they happen, even inside a notification
+     * batch. An observer attached to several subjects receives all their
+     * events; attach one per subject to tell them apart. Does nothing
+     * unless overridden.
+     */
+    virtual void onEvent(const Event& event) {}
 };
 
 
@@ -1,12 +1,16 @@
 // Player module - interface
 export module player;
 
+import <cstdint>;
 import <memory>;
+import <optional>;
 import <string>;
+import action;
 import board;
 import block;
 import level;
 import position;
+import rng;
 import subject;
 
 /*
@@ -15,7 +19,7 @@ import subject;
  * Abstract base class that represents a player in the game.
  * It stores the core game state shared by all player variants:
  *   - the player's Board
- *   - the Level strategy for block generation
+ *   - the Level strategy for block generation, and the player's own Rng
  *   - the currently falling Block, the next Block, and an optional held Block
  *   - the current position of the falling block
  *   - score, level number, and internal counters
@@ -23,21 +27,18 @@ import subject;
  * This class exposes all operations that a player can perform during a turn:
  *   movement, rotation, dropping, holding, level changes, and reset.
  *
- * BasicPlayer implements the actual gameplay logic.
- * Decorator classes (BlindEffect / HeavyEffect / ForceEffect) inherit from Player
- * and selectively override behaviour.
- *
- * Because this is an abstract base class:
- *   - most methods are pure virtual and implemented by BasicPlayer,
- *   - decorator-related helpers provide default "no effect" behaviour here.
+ * BasicPlayer implements the actual gameplay logic, including the special
+ * effects (blind / heavy / force) an opponent can play on the player.
+ * All methods are pure virtual and implemented by BasicPlayer.
  */
 export class Player : public Subject {
 protected:
     std::shared_ptr<Board> board;      // The player's game board
     std::shared_ptr<Level> level;      // Current Level object controlling block generation
-    std::shared_ptr<Block> curBlock;   // Block currently falling
-    std::shared_ptr<Block> nextBlock;  // Next block to spawn
-    std::shared_ptr<Block> heldBlock;  // Stored block (if any)
+    Rng rng;                           // Player's own block generator (survives level changes)
+    std::optional<Block> curBlock;     // Block currently falling (held by value)
+    std::optional<Block> nextBlock;    // Next block to spawn
+    std::optional<Block> heldBlock;    // Stored block (if any)
     Position curPos;                   // Position of the falling block on the board
     int score = 0;                     // Player's score
     int levelNum = 0;                  // Numerical level (0–4), used by scoring and Level objects
@@ -51,24 +52,33 @@ public:
     
     // ===== Basic getters =====
     // These functions allow observers (text/graphics) and game logic
-    // to query the current Player state. Implemented in BasicPlayer or decorators.
+    // to query the current Player state. Implemented in BasicPlayer.
     virtual std::shared_ptr<Board> getBoard() = 0;
     virtual int getScore() const = 0;
     virtual int getLevel() const = 0;
     virtual bool isAlive() const = 0;
-    virtual std::shared_ptr<Block> getCurBlock() = 0;
-    virtual std::shared_ptr<Block> getNextBlock() = 0;
-    virtual std::shared_ptr<Block> getHeldBlock() = 0;
+    // Block getters return nullptr when there is no such block; the
+    // pointer is only valid until the player's next operation.
+    virtual const Block* getCurBlock() const = 0;
+    virtual const Block* getNextBlock() const = 0;
+    virtual const Block* getHeldBlock() const = 0;
     virtual Position getCurPos() const = 0;
 
     // ===== Block operations =====
     // These define all possible actions during a turn.
     virtual void generateNextBlock() = 0;
     virtual bool spawnBlock() = 0;
-    virtual bool move(const std::string& dir) = 0;
-    virtual void rotate(const std::string& dir) = 0;
+    // Action::Left / Right / Down, repeated `times` times. The whole move
+    // is resolved in one call and observers are notified once.
+    virtual bool move(Action dir, int times = 1) = 0;
+    virtual void rotate(Action dir) = 0;    // Action::Clockwise / CounterClockwise
     virtual void drop() = 0;
     virtual void hold() = 0;
+    // Replace the current block with a new block of the given type at the
+    // spawn position (the I, J, L, ... testing commands and force). Returns
+    // false if there is no current block, the type is invalid, or the new
+    // block does not fit (the player then loses).
+    virtual bool replaceCurrentBlock(char blockType) = 0;
     
     // ===== Level adjustments =====
     virtual void levelUp() = 0;
@@ -77,30 +87,40 @@ public:
     // ===== Reset / configuration =====
     virtual void reset() = 0;                       // Reset player state for a new game
     virtual void setScriptFile(const std::string& filename) = 0;  // For Level 0
+    // Reseed the player's block generator. Game seeds player N with
+    // (match seed, stream N), so each player has its own sequence.
+    virtual void seedRng(std::uint64_t seed, std::uint64_t stream) = 0;
     
     // ===== Utility helpers =====
     virtual bool hasCurrentBlock() const = 0;       // True if current block exists
     virtual bool canMoveDown() const = 0;           // Used for drop/auto-drop logic
+    
+    // 64-bit Zobrist hash of the board plus the current piece (type, rotation,
+    // position), the next piece and the held piece. Equal states hash equal,
+    // so bots and tools can key transposition tables on it.
+    virtual std::uint64_t getStateHash() const = 0;
 
-    // ===== Decorator support =====
-    // Default behaviour: no effect applied.
-    // Decorator classes override relevant methods while delegating others.
-    virtual std::shared_ptr<Player> getWrappedPlayer() const; 
-    virtual bool hasBlindEffect() const;
-    virtual bool hasHeavyEffect() const;
-    virtual bool hasForceEffect() const;
-    virtual char getForcedBlockType() const;
+    // ===== Hint overlay =====
+    // The placement suggested by the last `hint` command. It is tied to the
+    // state it was computed for: getHintBlock() returns nullptr once the
+    // board or pieces change, so observers stop drawing a stale hint.
+    virtual void setHint(const Block& block, const Position& pos) = 0;
+    virtual const Block* getHintBlock() const = 0;  // hint block in its suggested rotation
+    virtual Position getHintPos() const = 0;        // where the hint block comes to rest
 
-    // ===== Effect helper methods =====
-    // Decorators override these to access state needed for forced-block logic.
-    virtual std::shared_ptr<Level> getLevelObject() const;
-    virtual int getNextBlockId() const;      
-    
-    // Default setNextBlock does nothing; ForceEffect overrides it.
-    virtual void setNextBlock(std::shared_ptr<Block> block);
-    
-    // Replace current block with a new block of specified type
-    // Used by ForceEffect to immediately replace opponent's current block
-    // Returns true if replacement was successful, false if block cannot be placed (player loses)
-    virtual bool replaceCurrentBlock(char blockType);
+    // ===== Special effects =====
+    // Effects played on this player by the opponent. They are kept as a few
+    // flags and counters on the player, so playing more of them never makes
+    // the player's operations slower:
+    //   - blind: the board is hidden from every spawn until that block's drop,
+    //     until reset()
+    //   - heavy: stacks; each adds 2 rows of fall after every successful
+    //     left/right move and after every rotation, until reset()
+    //   - force: the current block (or, if there is none, the next one
+    //     spawned) becomes blockType, once
+    virtual void applyBlind() = 0;
+    virtual void applyHeavy() = 0;
+    virtual void applyForce(char blockType) = 0;
+    virtual bool hasBlindEffect() const = 0;
+    virtual int getHeavyEffects() const = 0;   // number of heavy effects played
 };
@@ -3,8 +3,6 @@ module;
 
 module position;
 
-Position::Position(int r, int c) : row{r}, col{c} {}
-
 bool Position::operator==(const Position& other) const {
     return row == other.row && col == other.col;
 }
@@ -27,8 +27,10 @@ export struct Position {
      * @brief Constructs a Position
      * @param r Row coordinate (default: 0)
      * @param c Column coordinate (default: 0)
+     * 
+     * constexpr so that block shape tables can be built at compile time.
      */
-    Position(int r = 0, int c = 0);
+    constexpr Position(int r = 0, int c = 0) : row{r}, col{c} {}
     
     /**
      * @brief Copy constructor (default)
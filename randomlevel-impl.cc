@@ -0,0 +1,47 @@
+// RandomLevel module - implementation
+module randomlevel;
+
+import <array>;
+import <string>;
+import blockdistribution;
+import level;
+import rng;
+
+RandomLevel::RandomLevel(int num, const BlockDistribution &distribution)
+    : Level{num}, distribution{distribution} {}
+
+char RandomLevel::generateBlock(Rng &rng) {
+    if (!randomMode) return 'I';
+
+    if (queued == 0) refill(rng);
+    return lookahead[BLOCK_LOOKAHEAD - queued--];
+}
+
+void RandomLevel::refill(Rng &rng) {
+    // Drawn into a local first: stores into the member queue could alias
+    // the table, forcing a reload on every draw
+    std::array<char, BLOCK_LOOKAHEAD> drawn;
+    distribution.sample(rng, drawn);
+    lookahead = drawn;
+    queued = BLOCK_LOOKAHEAD;
+}
+
+void RandomLevel::setRandom(bool random) {
+    randomMode = random;
+}
+
+void RandomLevel::setScriptFile(const std::string &) {}
+
+LevelState RandomLevel::saveState() const {
+    LevelState state;
+    state.randomMode = randomMode;
+    state.queued = queued;
+    state.lookahead = lookahead;
+    return state;
+}
+
+void RandomLevel::restoreState(const LevelState &state) {
+    randomMode = state.randomMode;
+    queued = state.queued;
+    lookahead = state.lookahead;
+}
@@ -0,0 +1,56 @@
+/**
+ * @file randomlevel.cc
+ * @brief Interface for RandomLevel (shared base of Levels 1–4)
+ *
+ * The random levels differ only in their block distribution, so they share
+ * one generator: a level hands out types from a small lookahead queue,
+ * refilled from its BlockDistribution a batch at a time.
+ */
+
+export module randomlevel;
+
+import <array>;
+import <string>;
+import blockdistribution;
+import level;
+import rng;
+
+/**
+ * @class RandomLevel
+ * @brief Level that draws block types from a fixed distribution
+ *
+ * The queue is part of the level state, so a restored snapshot hands out
+ * the same blocks. Turning randomness off makes the level produce 'I'
+ * blocks only (for testing); the queue is kept for when it is turned on.
+ */
+export class RandomLevel : public Level {
+    const BlockDistribution &distribution;  ///< Block weights of this level
+    bool randomMode = true;                 ///< Whether randomness is enabled
+    int queued = 0;                         ///< Types left in the lookahead queue
+    std::array<char, BLOCK_LOOKAHEAD> lookahead{};  ///< Drawn types, handed out front to back
+
+    // Draws a full batch into the (empty) lookahead queue. Kept out of
+    // generateBlock() so the common path stays a few instructions.
+    [[gnu::noinline]] void refill(Rng &rng);
+
+public:
+    /**
+     * @brief Constructs a random level
+     * @param num Level number
+     * @param distribution Block weights (one of the LEVELn_BLOCKS tables)
+     */
+    RandomLevel(int num, const BlockDistribution &distribution);
+
+    /// Next type from the lookahead queue, refilling it from rng when empty.
+    char generateBlock(Rng &rng) override;
+
+    /// Enable or disable random generation.
+    void setRandom(bool random) override;
+
+    /// Random levels ignore script files.
+    void setScriptFile(const std::string &filename) override;
+
+    /// Random flag and lookahead queue, saved in player snapshots.
+    LevelState saveState() const override;
+    void restoreState(const LevelState &state) override;
+};
@@ -0,0 +1,19 @@
+// Rng module - implementation
+module rng;
+
+import <cstdint>;
+
+Rng::Rng() : Rng{1, 0} {}
+
+Rng::Rng(std::uint64_t seed, std::uint64_t stream) {
+    this->seed(seed, stream);
+}
+
+void Rng::seed(std::uint64_t seed, std::uint64_t stream) {
+    // Standard PCG32 seeding: select the stream, then mix the seed in
+    state = 0;
+    increment = (stream << 1) | 1;
+    next();
+    state += seed;
+    next();
+}
@@ -0,0 +1,59 @@
+/**
+ * @file rng.cc
+ * @brief Interface for the Rng class (block generation randomness)
+ *
+ * This file defines the random number generator the random levels draw
+ * block types from. Each player owns one, so every player's block
+ * sequence is its own deterministic stream.
+ */
+
+export module rng;
+
+import <cstdint>;
+
+/**
+ * @class Rng
+ * @brief PCG32 generator (64-bit LCG state, permuted 32-bit output)
+ *
+ * Small (16 bytes), fast and trivially copyable, so it is saved in player
+ * snapshots by plain copy. A generator is identified by a seed and a
+ * stream: generators with the same seed and different streams produce
+ * independent sequences, which is how the two players of a match get
+ * different blocks from one match seed.
+ */
+export class Rng {
+    std::uint64_t state = 0;       ///< LCG state
+    std::uint64_t increment = 1;   ///< LCG increment (odd; selects the stream)
+
+public:
+    /**
+     * @brief Constructs a generator with seed 1 on stream 0
+     */
+    Rng();
+
+    /**
+     * @brief Constructs a seeded generator
+     * @param seed Seed value
+     * @param stream Stream selector (e.g. the player number)
+     */
+    Rng(std::uint64_t seed, std::uint64_t stream);
+
+    /**
+     * @brief Reseeds the generator
+     * @param seed Seed value
+     * @param stream Stream selector (e.g. the player number)
+     */
+    void seed(std::uint64_t seed, std::uint64_t stream);
+
+    /**
+     * @brief Draws the next number
+     * @return Uniform 32-bit value
+     */
+    std::uint32_t next() {
+        std::uint64_t old = state;
+        state = old * 6364136223846793005ull + increment;
+        std::uint32_t xorshifted = static_cast<std::uint32_t>(((old >> 18) ^ old) >> 27);
+        std::uint32_t rot = static_cast<std::uint32_t>(old >> 59);
+        return (xorshifted >> rot) | (xorshifted << ((32 - rot) & 31));
+    }
+};
@@ -3,13 +3,11 @@ export module sblock;
 
 import block;
 
+/*
+ * SBlock:
+ * Selects the 'S' shape; rotation data lives in the shared SHAPES table.
+ */
 export class SBlock : public Block {
-    int rotation = 0;
-    
 public:
     SBlock(int id, int level);
-    void rotateCW() override;
-    void rotateCCW() override;
 };
-
-
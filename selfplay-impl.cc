@@ -0,0 +1,55 @@
+// Selfplay module - implementation
+module selfplay;
+
+import <string>;
+import action;
+import game;
+import hint;
+import player;
+
+MatchResult playMatch(unsigned int seed, const MatchOptions& options, HintFinder& finder,
+                      const Heuristic& bot1, const Heuristic& bot2) {
+    // Game setup follows main.cc
+    Game game;
+    game.setSeed(seed);
+    for (int i = 0; i < options.startLevel; ++i) {
+        game.getPlayer1()->levelUp();
+        game.getPlayer2()->levelUp();
+    }
+    game.getPlayer1()->setScriptFile(options.scriptFile1);
+    game.getPlayer2()->setScriptFile(options.scriptFile2);
+    game.getPlayer1()->generateNextBlock();
+    game.getPlayer2()->generateNextBlock();
+    game.run();
+
+    MatchResult result;
+    int current = 1;
+    while (!game.isGameOver() && result.drops < options.maxDrops) {
+        auto hint = finder.find(*game.getCurrentPlayer(), current == 1 ? bot1 : bot2);
+        if (!hint) break;
+
+        bool special = false;
+        int droppingPlayer = 0;
+        bool dropped = false;
+        for (Action action : hint->commands) {
+            special = game.handleCommand(action, 1, &droppingPlayer, &dropped);
+        }
+        if (!dropped) break;
+        ++result.drops;
+
+        if (special && droppingPlayer > 0) {
+            game.applySpecialEffect("heavy", droppingPlayer == 1 ? 2 : 1);
+        }
+        game.switchTurn();
+        current = (current == 1) ? 2 : 1;
+        game.getCurrentPlayer()->spawnBlock();
+    }
+
+    result.score1 = game.getPlayer1()->getScore();
+    result.score2 = game.getPlayer2()->getScore();
+    bool alive1 = game.getPlayer1()->isAlive();
+    bool alive2 = game.getPlayer2()->isAlive();
+    if (alive1 && !alive2) result.winner = 1;
+    else if (!alive1 && alive2) result.winner = 2;
+    return result;
+}
@@ -0,0 +1,53 @@
+/**
+ * @file selfplay.cc
+ * @brief Interface for bot-vs-bot matches (headless self-play)
+ *
+ * This file defines playMatch(), which plays one complete two-player game
+ * between two hint bots with no observers attached. The simulator and the
+ * tournament runner are both built on it.
+ */
+
+export module selfplay;
+
+import <string>;
+import hint;
+
+/**
+ * @struct MatchOptions
+ * @brief How each match is set up
+ */
+export struct MatchOptions {
+    int startLevel = 0;         ///< Level both players start at (0-4)
+    long long maxDrops = 2000;  ///< Cap on drops by both players (level 0 scripts can go on forever)
+    std::string scriptFile1 = "biquadris_sequence1.txt";  ///< Level 0 script of player 1
+    std::string scriptFile2 = "biquadris_sequence2.txt";  ///< Level 0 script of player 2
+};
+
+/**
+ * @struct MatchResult
+ * @brief Outcome of one match
+ */
+export struct MatchResult {
+    long long drops = 0;    ///< Blocks dropped by both players
+    int score1 = 0;         ///< Final score of player 1
+    int score2 = 0;         ///< Final score of player 2
+    int winner = 0;         ///< 1 or 2, or 0 if both lost or the drop cap was hit
+};
+
+/**
+ * @brief Plays one bot-vs-bot game
+ * @param seed Match seed (see Game::setSeed())
+ * @param options Start level, drop cap and script files
+ * @param finder Placement search to use (owned by the calling thread)
+ * @param bot1 Heuristic that plays player 1
+ * @param bot2 Heuristic that plays player 2
+ * @return Scores, length and winner
+ *
+ * The game is set up and driven the way main.cc does it: each turn the
+ * current bot's best placement is issued through Game::handleCommand, then
+ * the turn passes and the next block spawns. A bot that clears 2+ rows
+ * makes its opponent heavy. Each match owns all its state, including the
+ * players' generators, so different threads can play matches concurrently.
+ */
+export MatchResult playMatch(unsigned int seed, const MatchOptions& options, HintFinder& finder,
+                             const Heuristic& bot1, const Heuristic& bot2);
@@ -0,0 +1,76 @@
+// SequenceTable module - implementation
+module;
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+module sequencetable;
+
+import <cctype>;
+import <fstream>;
+import <map>;
+import <memory>;
+import <mutex>;
+import <string>;
+import <utility>;
+import <vector>;
+
+// Script characters are read like `file >> c`: every non-whitespace byte
+static bool isBlockChar(char c) {
+    return !std::isspace(static_cast<unsigned char>(c));
+}
+
+// Parses a regular file through a read-only mapping. Returns false if the
+// file cannot be mapped (e.g. a pipe), leaving the caller to stream it.
+static bool parseMapped(const std::string& filename, std::vector<char>& blocks) {
+    int fd = ::open(filename.c_str(), O_RDONLY);
+    if (fd < 0) return false;
+
+    struct stat info;
+    if (::fstat(fd, &info) != 0 || !S_ISREG(info.st_mode)) {
+        ::close(fd);
+        return false;
+    }
+    if (info.st_size == 0) {
+        ::close(fd);
+        return true;
+    }
+
+    void* mapped = ::mmap(nullptr, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (mapped == MAP_FAILED) return false;
+
+    const char* data = static_cast<const char*>(mapped);
+    blocks.reserve(info.st_size / 2);  // scripts are usually one block per word
+    for (off_t i = 0; i < info.st_size; ++i) {
+        if (isBlockChar(data[i])) blocks.push_back(data[i]);
+    }
+    ::munmap(mapped, info.st_size);
+    return true;
+}
+
+SequenceTable::SequenceTable(std::vector<char> blocks) : blocks{std::move(blocks)} {
+    this->blocks.shrink_to_fit();
+}
+
+std::shared_ptr<const SequenceTable> SequenceTable::load(const std::string& filename) {
+    static std::mutex cacheMutex;
+    static std::map<std::string, std::shared_ptr<const SequenceTable>> cache;
+
+    std::lock_guard<std::mutex> lock{cacheMutex};
+    auto found = cache.find(filename);
+    if (found != cache.end()) return found->second;
+
+    std::vector<char> blocks;
+    if (!parseMapped(filename, blocks)) {
+        blocks.clear();
+        std::ifstream file{filename};
+        char c;
+        while (file >> c) blocks.push_back(c);
+    }
+
+    auto table = std::make_shared<const SequenceTable>(std::move(blocks));
+    cache.emplace(filename, table);
+    return table;
+}
@@ -0,0 +1,65 @@
+/**
+ * @file sequencetable.cc
+ * @brief Interface for the SequenceTable class (parsed Level 0 scripts)
+ *
+ * This file defines SequenceTable, the parsed, immutable form of a Level 0
+ * script file. Tables are shared: every Level0 reading the same file holds
+ * the same table and keeps only its own cursor into it.
+ */
+
+export module sequencetable;
+
+import <memory>;
+import <string>;
+import <vector>;
+
+/**
+ * @class SequenceTable
+ * @brief The block types of a script file, one byte each, whitespace removed
+ *
+ * Files are parsed once per process: load() keeps every table it builds
+ * in a cache keyed by file name, so later loads (new games, restarts,
+ * levelling down to 0) do not touch the filesystem. Regular files are
+ * read through a read-only memory mapping, so even very large scripts are
+ * scanned in place instead of being streamed character by character.
+ *
+ * Tables never change after construction, so they can be shared freely,
+ * including across threads.
+ */
+export class SequenceTable {
+    std::vector<char> blocks;   ///< Block type characters in script order
+
+public:
+    /**
+     * @brief Constructs a table from already parsed block types
+     * @param blocks Block type characters in order
+     */
+    explicit SequenceTable(std::vector<char> blocks);
+
+    /**
+     * @brief Gets the shared table of a script file
+     * @param filename Path of the script file
+     * @return The cached table, parsed on first use (empty if the file
+     *         cannot be read)
+     *
+     * Thread-safe.
+     */
+    static std::shared_ptr<const SequenceTable> load(const std::string& filename);
+
+    /**
+     * @brief Gets the number of blocks in the script
+     */
+    int size() const { return static_cast<int>(blocks.size()); }
+
+    /**
+     * @brief Checks whether the script has no blocks
+     */
+    bool empty() const { return blocks.empty(); }
+
+    /**
+     * @brief Gets a block type
+     * @param index Position in the script (0 .. size() - 1)
+     * @return Block type character, as written in the file
+     */
+    char at(int index) const { return blocks[index]; }
+};
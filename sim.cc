@@ -0,0 +1,75 @@
+/**
+ * @file sim.cc
+ * @brief Headless self-play simulator (bot vs bot, no display, no X11)
+ *
+ * Plays complete two-player games between hint bots (see playMatch())
+ * over a range of seeds and reports engine throughput and game
+ * statistics. No observers are attached and no input is read, so the
+ * numbers measure the engine alone.
+ *
+ * Usage: ./biquadris-sim [-seeds first last] [-startlevel n] [-maxdrops n]
+ *                        [-scriptfile1 file] [-scriptfile2 file]
+ */
+
+import <iostream>;
+import <string>;
+import <memory>;
+import <chrono>;
+import hint;
+import selfplay;
+
+using namespace std;
+
+int main(int argc, char* argv[]) {
+    MatchOptions options;
+    unsigned int firstSeed = 0;
+    unsigned int lastSeed = 99;
+    for (int i = 1; i < argc; ++i) {
+        string arg = argv[i];
+        if (arg == "-seeds" && i + 2 < argc) {
+            firstSeed = stoul(argv[++i]);
+            lastSeed = stoul(argv[++i]);
+        } else if (arg == "-startlevel" && i + 1 < argc) {
+            options.startLevel = stoi(argv[++i]);
+            if (options.startLevel < 0) options.startLevel = 0;
+            if (options.startLevel > 4) options.startLevel = 4;
+        } else if (arg == "-maxdrops" && i + 1 < argc) {
+            options.maxDrops = stoll(argv[++i]);
+        } else if (arg == "-scriptfile1" && i + 1 < argc) {
+            options.scriptFile1 = argv[++i];
+        } else if (arg == "-scriptfile2" && i + 1 < argc) {
+            options.scriptFile2 = argv[++i];
+        }
+    }
+    if (lastSeed < firstSeed) {
+        cerr << "Error: empty seed range" << endl;
+        return 1;
+    }
+
+    HintFinder finder;
+    WeightedHeuristic heuristic;
+
+    long long games = 0;
+    long long drops = 0;
+    long long totalScore = 0;
+    long long wins[3] = {0, 0, 0};
+    auto start = chrono::steady_clock::now();
+    for (unsigned int seed = firstSeed; ; ++seed) {
+        MatchResult result = playMatch(seed, options, finder, heuristic, heuristic);
+        ++games;
+        drops += result.drops;
+        totalScore += result.score1 + result.score2;
+        ++wins[result.winner];
+        if (seed == lastSeed) break;
+    }
+    double elapsed = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+    cout << "games: " << games << " in " << elapsed << " s ("
+         << games / elapsed << " games/s, "
+         << static_cast<long long>(drops / elapsed) << " drops/s)" << endl;
+    cout << "average score per player: " << static_cast<double>(totalScore) / (2 * games) << endl;
+    cout << "average game length: " << static_cast<double>(drops) / games << " drops" << endl;
+    cout << "player 1 wins: " << wins[1] << ", player 2 wins: " << wins[2]
+         << ", unfinished or draw: " << wins[0] << endl;
+    return 0;
+}
@@ -8,6 +8,8 @@
 
 module subject;
 
+import <cstdint>;
+import <initializer_list>;
 import <vector>;
 import observer;
 
@@ -26,14 +28,89 @@ void Subject::detach(Observer* obs) {
     }
 }
 
-void Subject::notifyObservers() {
+void Subject::notifyObservers(const Changes& changed) {
+    pending |= changed;
+    if (batchDepth > 0) {
+        dirty = true;
+        return;
+    }
+    ++notificationCount;
+    delivered = pending;
+    pending = Changes{};
     for (auto obs : observers) {
         obs->notify();
     }
+    delivered = Changes{};
+}
+
+const Changes& Subject::getChanges() const {
+    return delivered;
+}
+
+void Subject::deliver(const Event& event) {
+    for (auto obs : observers) {
+        obs->onEvent(event);
+    }
+}
+
+void Subject::beginBatch() {
+    ++batchDepth;
+}
+
+void Subject::endBatch() {
+    if (--batchDepth == 0 && dirty) {
+        dirty = false;
+        notifyObservers(Changes{});
+    }
+}
+
+long long Subject::getNotificationCount() const {
+    return notificationCount;
 }
 
 std::vector<Observer*> Subject::getObservers() const {
     return observers;
 }
 
+NotificationBatch::NotificationBatch(std::initializer_list<Subject*> subjects)
+    : subjects{subjects} {
+    for (auto subject : this->subjects) {
+        subject->beginBatch();
+    }
+}
+
+NotificationBatch::~NotificationBatch() {
+    finish();
+}
+
+void NotificationBatch::finish() {
+    if (!open) return;
+    open = false;
+    
+    // Collect each observer of a changed subject once, then notify them.
+    // Every subject's changes are in place first, since an observer of
+    // several subjects reads all of them.
+    std::vector<Observer*> frame;
+    for (auto subject : subjects) {
+        if (--subject->batchDepth > 0 || !subject->dirty) continue;
+        subject->dirty = false;
+        ++subject->notificationCount;
+        subject->delivered = subject->pending;
+        subject->pending = Changes{};
+        for (auto obs : subject->observers) {
+            bool seen = false;
+            for (auto other : frame) {
+                if (other == obs) seen = true;
+            }
+            if (!seen) frame.push_back(obs);
+        }
+    }
+    for (auto obs : frame) {
+        obs->notify();
+    }
+    for (auto subject : subjects) {
+        subject->delivered = Changes{};
+    }
+}
+
 
@@ -5,13 +5,63 @@
  * This file defines the abstract Subject class, which is the core of the
  * Observer design pattern. Subject maintains a list of observers and
  * notifies them when its state changes. This is a pure abstract class.
+ * 
+ * Notifications can be batched: while a batch is open a Subject only
+ * records that it changed, and its observers are notified once when the
+ * batch ends. NotificationBatch opens one over several subjects that share
+ * observers, so one top-level command renders one frame.
+ * 
+ * Each notification carries the regions that changed since the previous
+ * one (Changes), so an observer can redraw only those.
  */
 
 export module subject;
 
+import <cstdint>;
+import <initializer_list>;
 import <vector>;
 import observer;
 
+/**
+ * @struct Changes
+ * @brief The regions of a subject's display that changed
+ * 
+ * Board rows are one bit per row (bit r is row r); the panels beside the
+ * board are flags. Changes accumulate until the observers are notified.
+ */
+export struct Changes {
+    static constexpr std::uint64_t ALL_ROWS = ~std::uint64_t{0};
+    
+    /// Bits of `panels`
+    enum Panel : std::uint8_t {
+        Next = 1 << 0,   ///< The next block
+        Held = 1 << 1,   ///< The held block
+        Stats = 1 << 2,  ///< Score and level
+    };
+    static constexpr std::uint8_t ALL_PANELS = Next | Held | Stats;
+    
+    std::uint64_t rows = 0;  ///< Board rows that changed
+    std::uint8_t panels = 0; ///< Panel bits that changed
+    
+    /// Everything changed (the default when a caller does not say what)
+    static constexpr Changes all() { return Changes{ALL_ROWS, ALL_PANELS}; }
+    
+    /// Board rows first..last (inclusive, clamped to 0-63) as a row mask
+    static constexpr std::uint64_t rowRange(int first, int last) {
+        if (first < 0) first = 0;
+        if (last > 63) last = 63;
+        if (first > last) return 0;
+        std::uint64_t upToLast = last == 63 ? ALL_ROWS : (std::uint64_t{1} << (last + 1)) - 1;
+        return upToLast & ~((std::uint64_t{1} << first) - 1);
+    }
+    
+    Changes& operator|=(const Changes& other) {
+        rows |= other.rows;
+        panels |= other.panels;
+        return *this;
+    }
+};
+
 /**
  * @class Subject
  * @brief Abstract base class for objects that can be observed
@@ -25,6 +75,16 @@ import observer;
  */
 export class Subject {
     std::vector<Observer*> observers;  ///< List of observers (non-owning pointers)
+    int batchDepth = 0;                ///< Open batches; notifications wait while > 0
+    bool dirty = false;                ///< State changed during the open batch
+    Changes pending;                   ///< Changes not yet delivered to the observers
+    Changes delivered;                 ///< Changes of the notification in progress
+    long long notificationCount = 0;   ///< Times the observers have been notified
+    
+    friend class NotificationBatch;
+    
+    /// Calls onEvent() on every observer
+    void deliver(const Event& event);
     
 public:
     /**
@@ -55,21 +115,119 @@ public:
     
     /**
      * @brief Notifies all registered observers of a state change
+     * @param changed What changed (everything, if not given)
      * 
      * Calls the notify() method on each observer in the list.
      * This should be called by derived classes whenever their
      * state changes in a way that observers should know about.
+     * Inside a batch the subject is only marked dirty.
+     */
+    void notifyObservers(const Changes& changed = Changes::all());
+    
+    /**
+     * @brief Records a change without notifying the observers
+     * @param changed What changed
+     * 
+     * The change is delivered with the next notification (for state that
+     * changes silently, such as a restored snapshot).
+     */
+    void markChanged(const Changes& changed) {
+        pending |= changed;
+    }
+    
+    /**
+     * @brief Gets what changed since the previous notification
+     * @return The changed regions; empty outside notify() and for a subject
+     *         that did not change in the frame being notified
+     */
+    const Changes& getChanges() const;
+    
+    /**
+     * @brief Checks whether any observer is attached
+     * @return true if notifications reach someone
+     * 
+     * Lets a subject skip working out what changed when nobody is
+     * watching (as in self-play and search).
+     */
+    bool hasObservers() const {
+        return !observers.empty();
+    }
+    
+    /**
+     * @brief Publishes an event to all registered observers
+     * @param event What changed
+     * 
+     * Costs nothing beyond the emptiness check when no observer is
+     * attached (as in self-play and search).
+     */
+    void publish(const Event& event) {
+        if (!observers.empty()) deliver(event);
+    }
+    
+    /**
+     * @brief Opens a batch: notifications are deferred until endBatch()
+     * 
+     * Batches nest; only the outermost endBatch() notifies.
+     */
+    void beginBatch();
+    
+    /**
+     * @brief Closes a batch, notifying the observers once if the state
+     * changed while it was open
+     */
+    void endBatch();
+    
+    /**
+     * @brief Gets how many times the observers have been notified
+     * @return Notifications delivered (each deferred batch counts once)
      */
-    void notifyObservers();
+    long long getNotificationCount() const;
     
     /**
      * @brief Gets a copy of all registered observers
      * @return Vector of observer pointers
      * 
-     * This is useful when wrapping a player with decorators
-     * to preserve observers.
+     * This is useful for handing the same observers on to
+     * another subject.
      */
     std::vector<Observer*> getObservers() const;
 };
 
+/**
+ * @class NotificationBatch
+ * @brief Batches the notifications of several subjects for one frame
+ * 
+ * Opens a batch on every subject for its lifetime. When it finishes, every
+ * observer of a subject that changed is notified exactly once, even when
+ * it observes several of them (the text display observes both players).
+ */
+export class NotificationBatch {
+    std::vector<Subject*> subjects;  ///< Subjects being batched (non-owning)
+    bool open = true;                ///< false once finish() has run
+    
+public:
+    /**
+     * @brief Opens a batch on each subject
+     * @param subjects The subjects whose notifications are deferred
+     */
+    explicit NotificationBatch(std::initializer_list<Subject*> subjects);
+    
+    NotificationBatch(const NotificationBatch&) = delete;
+    NotificationBatch& operator=(const NotificationBatch&) = delete;
+    
+    /**
+     * @brief Finishes the batch if finish() was not called
+     */
+    ~NotificationBatch();
+    
+    /**
+     * @brief Closes the batch and renders the frame
+     * 
+     * Notifies each observer of the changed subjects once. Later calls do
+     * nothing, so the frame can be rendered before the batch goes out of
+     * scope (e.g. before prompting the user).
+     */
+    void finish();
+};
+
 
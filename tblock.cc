@@ -3,13 +3,11 @@ export module tblock;
 
 import block;
 
+/*
+ * TBlock:
+ * Selects the 'T' shape; rotation data lives in the shared SHAPES table.
+ */
 export class TBlock : public Block {
-    int rotation = 0;
-    
 public:
     TBlock(int id, int level);
-    void rotateCW() override;
-    void rotateCCW() override;
 };
-
-
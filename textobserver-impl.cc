@@ -7,6 +7,10 @@
  * on the console with proper formatting and layout.
  */
 
+module;
+#include <sys/ioctl.h>
+#include <unistd.h>
+
 module textobserver;
 
 import observer;
@@ -14,20 +18,29 @@ import player;
 import board;
 import block;
 import position;
+import <algorithm>;
+import <array>;
 import <iostream>;
 import <string>;
 import <vector>;
 import <memory>;
 
-TextObserver::TextObserver(Player* p1, Player* p2) 
-    : player1{p1}, player2{p2} {}
+TextObserver::TextObserver(Player* p1, Player* p2, bool ansi) 
+    : player1{p1}, player2{p2}, ansi{ansi} {}
+
+TextObserver::~TextObserver() {
+    output.clear();
+    leaveScreen();
+    std::cout.write(output.data(), static_cast<std::streamsize>(output.size()));
+    std::cout.flush();
+}
 
 void TextObserver::notify() {
     display();
 }
 
 // Helper function to get block lines for display
-std::vector<std::string> getBlockLines(Block* block) {
+std::vector<std::string> getBlockLines(const Block* block) {
     using namespace std;
     vector<string> lines;
     
@@ -73,132 +86,213 @@ std::vector<std::string> getBlockLines(Block* block) {
     return lines;
 }
 
-void TextObserver::display() {
-    using namespace std;
-    
-    // Get all information from Player (Subject)
-    auto board1 = player1->getBoard();
-    auto board2 = player2->getBoard();
-    int level1 = player1->getLevel();
-    int level2 = player2->getLevel();
-    int score1 = player1->getScore();
-    int score2 = player2->getScore();
-    
-    auto curBlock1 = player1->getCurBlock();
-    auto curBlock2 = player2->getCurBlock();
-    Position curPos1 = player1->getCurPos();
-    Position curPos2 = player2->getCurPos();
-    
-    auto nextBlock1 = player1->getNextBlock();
-    auto nextBlock2 = player2->getNextBlock();
-    auto heldBlock1 = player1->getHeldBlock();
-    auto heldBlock2 = player2->getHeldBlock();
-    
-    // Display level and score info for both players
-    cout << "Level:    " << level1 << "            Level:    " << level2 << endl;
-    cout << "Score:    " << score1 << "            Score:    " << score2 << endl;
-    cout << "-----------            -----------" << endl;
-    
-    // Create temporary grids to overlay current blocks
-    vector<vector<char>> display1(board1->getRows(), vector<char>(board1->getCols()));
-    vector<vector<char>> display2(board2->getRows(), vector<char>(board2->getCols()));
-    
-    // Copy board state
-    for (int r = 0; r < board1->getRows(); ++r) {
-        for (int c = 0; c < board1->getCols(); ++c) {
-            display1[r][c] = board1->getCell(r, c);
-            display2[r][c] = board2->getCell(r, c);
+// One board's cells as displayed (with the hint and current block overlaid)
+using Grid = std::array<std::array<char, Board::getCols()>, Board::getRows()>;
+
+// Draws `block` at `pos` onto the grid as `symbol`, clipped to the board
+static void overlay(Grid& grid, const Block& block, Position pos, char symbol) {
+    for (const auto& cell : block.getCells()) {
+        int r = pos.row + cell.row;
+        int c = pos.col + cell.col;
+        if (r >= 0 && r < Board::getRows() && c >= 0 && c < Board::getCols()) {
+            grid[r][c] = symbol;
         }
     }
-    
-    // Overlay current block for player 1
-    if (curBlock1) {
-        for (const auto& cell : curBlock1->getCells()) {
-            int r = curPos1.row + cell.row;
-            int c = curPos1.col + cell.col;
-            if (r >= 0 && r < board1->getRows() && c >= 0 && c < board1->getCols()) {
-                display1[r][c] = curBlock1->getSymbol();
-            }
+}
+
+// Fills the grid with what a player's board shows
+static void fillGrid(Grid& grid, Player& player) {
+    auto board = player.getBoard();
+    for (int r = 0; r < Board::getRows(); ++r) {
+        for (int c = 0; c < Board::getCols(); ++c) {
+            grid[r][c] = board->getCell(r, c);
         }
     }
     
-    // Overlay current block for player 2
-    if (curBlock2) {
-        for (const auto& cell : curBlock2->getCells()) {
-            int r = curPos2.row + cell.row;
-            int c = curPos2.col + cell.col;
-            if (r >= 0 && r < board2->getRows() && c >= 0 && c < board2->getCols()) {
-                display2[r][c] = curBlock2->getSymbol();
-            }
-        }
+    // Hints go under the current block, drawn in the block's lowercase
+    // symbol ('?' already marks blinded cells)
+    if (auto hint = player.getHintBlock()) {
+        char symbol = static_cast<char>(hint->getSymbol() - 'A' + 'a');
+        overlay(grid, *hint, player.getHintPos(), symbol);
+    }
+    if (auto current = player.getCurBlock()) {
+        overlay(grid, *current, player.getCurPos(), current->getSymbol());
     }
+}
+
+// Appends two block previews side by side, player 2's starting at column 23
+static void appendPreviews(std::vector<std::string>& lines, std::size_t& count,
+                           const Block* block1, const Block* block2) {
+    std::vector<std::string> lines1 = getBlockLines(block1);
+    std::vector<std::string> lines2 = getBlockLines(block2);
     
-    // Display both boards side by side
-    for (int r = 0; r < board1->getRows(); ++r) {
-        for (int c = 0; c < board1->getCols(); ++c) {
-            cout << display1[r][c];
-        }
-        cout << "            ";  // 12 spaces
-        for (int c = 0; c < board2->getCols(); ++c) {
-            cout << display2[r][c];
-        }
-        cout << endl;
+    std::size_t maxLines = std::max(lines1.size(), lines2.size());
+    for (std::size_t i = 0; i < maxLines; ++i) {
+        if (count == lines.size()) lines.emplace_back();
+        std::string& line = lines[count++];
+        line.clear();
+        if (i < lines1.size()) line += lines1[i];
+        // Pad to reach player 2's column
+        if (line.size() < 23) line.append(23 - line.size(), ' ');
+        if (i < lines2.size()) line += lines2[i];
     }
+}
+
+void TextObserver::compose() {
+    std::size_t count = 0;
+    auto nextLine = [&]() -> std::string& {
+        if (count == frame.size()) frame.emplace_back();
+        std::string& line = frame[count++];
+        line.clear();
+        return line;
+    };
     
-    cout << "-----------            -----------" << endl;
+    // Level and score info for both players
+    nextLine().append("Level:    ").append(std::to_string(player1->getLevel()))
+        .append("            Level:    ").append(std::to_string(player2->getLevel()));
+    nextLine().append("Score:    ").append(std::to_string(player1->getScore()))
+        .append("            Score:    ").append(std::to_string(player2->getScore()));
+    nextLine() = "-----------            -----------";
     
-    // Display next blocks
-    cout << "Next:                  Next:" << endl;
+    // Both boards side by side
+    Grid grid1, grid2;
+    fillGrid(grid1, *player1);
+    fillGrid(grid2, *player2);
+    for (int r = 0; r < Board::getRows(); ++r) {
+        std::string& line = nextLine();
+        line.append(grid1[r].begin(), grid1[r].end());
+        line.append(12, ' ');
+        line.append(grid2[r].begin(), grid2[r].end());
+    }
     
-    vector<string> next1Lines = getBlockLines(nextBlock1.get());
-    vector<string> next2Lines = getBlockLines(nextBlock2.get());
+    nextLine() = "-----------            -----------";
     
-    size_t maxLines = max(next1Lines.size(), next2Lines.size());
-    for (size_t i = 0; i < maxLines; ++i) {
-        // Display next block 1
-        if (i < next1Lines.size()) {
-            cout << next1Lines[i];
-            // Pad to reach player 2's column
-            for (size_t j = next1Lines[i].length(); j < 23; ++j) {
-                cout << ' ';
-            }
-        } else {
-            for (int j = 0; j < 23; ++j) cout << ' ';
-        }
-        
-        // Display next block 2
-        if (i < next2Lines.size()) {
-            cout << next2Lines[i];
-        }
-        cout << endl;
+    // Next blocks
+    nextLine() = "Next:                  Next:";
+    appendPreviews(frame, count, player1->getNextBlock(), player2->getNextBlock());
+    
+    // Held blocks if they exist
+    const Block* held1 = player1->getHeldBlock();
+    const Block* held2 = player2->getHeldBlock();
+    if (held1 || held2) {
+        nextLine() = "Held:                  Held:";
+        appendPreviews(frame, count, held1, held2);
     }
     
-    // Display held blocks if they exist
-    if (heldBlock1 || heldBlock2) {
-        cout << "Held:                  Held:" << endl;
+    frame.resize(count);
+}
+
+// Appends the escape that moves the cursor to (row, col), counted from 0
+static void moveCursor(std::string& output, std::size_t row, std::size_t col) {
+    output += "\x1b[";
+    output += std::to_string(row + 1);
+    output += ';';
+    output += std::to_string(col + 1);
+    output += 'H';
+}
+
+// Rows of the terminal on standard output, or 0 if it is not a terminal
+static int terminalRows() {
+    winsize size{};
+    if (ioctl(STDOUT_FILENO, TIOCGWINSZ, &size) != 0) return 0;
+    return size.ws_row;
+}
+
+// True if character i of `now` differs from what is on screen
+static bool changedAt(const std::string& now, const std::string& before, std::size_t i) {
+    return i >= before.size() || now[i] != before[i];
+}
+
+void TextObserver::leaveScreen() {
+    if (shown.empty()) return;
+    // Reset the scroll region and return to the normal screen (with the
+    // text that was there before the game took over)
+    output += "\x1b[r\x1b[?1049l";
+    shown.clear();
+    scrollTop = 0;
+}
+
+void TextObserver::diff(int rows) {
+    // Unchanged gaps shorter than this are rewritten rather than skipped,
+    // since a cursor move costs about as many bytes
+    constexpr std::size_t MIN_SKIP = 8;
+    static const std::string blank;
+    
+    // The first frame switches to the alternate screen, so the welcome text
+    // on the normal screen is kept, and the frame's rows are screen rows
+    if (shown.empty()) output += "\x1b[?1049h\x1b[H\x1b[2J";
+    
+    std::size_t lines = std::max(frame.size(), shown.size());
+    for (std::size_t r = 0; r < lines; ++r) {
+        const std::string& now = r < frame.size() ? frame[r] : blank;
         
-        vector<string> held1Lines = getBlockLines(heldBlock1.get());
-        vector<string> held2Lines = getBlockLines(heldBlock2.get());
+        // Rows below the previous frame may hold messages: rewrite them whole
+        if (r >= shown.size()) {
+            moveCursor(output, r, 0);
+            output += now;
+            output += "\x1b[K";
+            continue;
+        }
         
-        maxLines = max(held1Lines.size(), held2Lines.size());
-        for (size_t i = 0; i < maxLines; ++i) {
-            // Display held block 1
-            if (i < held1Lines.size()) {
-                cout << held1Lines[i];
-                for (size_t j = held1Lines[i].length(); j < 23; ++j) {
-                    cout << ' ';
-                }
-            } else {
-                for (int j = 0; j < 23; ++j) cout << ' ';
+        const std::string& before = shown[r];
+        std::size_t c = 0;
+        while (c < now.size()) {
+            if (!changedAt(now, before, c)) {
+                ++c;
+                continue;
             }
-            
-            // Display held block 2
-            if (i < held2Lines.size()) {
-                cout << held2Lines[i];
+            // A run of changes, bridging short unchanged gaps
+            std::size_t last = c;
+            for (std::size_t i = c + 1; i < now.size() && i - last < MIN_SKIP; ++i) {
+                if (changedAt(now, before, i)) last = i;
             }
-            cout << endl;
+            moveCursor(output, r, c);
+            output.append(now, c, last + 1 - c);
+            c = last + 1;
         }
+        
+        // Erase what is left of a longer previous line
+        if (before.size() > now.size()) {
+            moveCursor(output, r, now.size());
+            output += "\x1b[K";
+        }
+    }
+    
+    // Messages and input scroll only in the rows below the frame, so the
+    // frame never moves
+    int top = static_cast<int>(frame.size()) + 1;
+    if (top != scrollTop || rows != scrollBottom) {
+        output += "\x1b[" + std::to_string(top) + ";" + std::to_string(rows) + "r";
+        scrollTop = top;
+        scrollBottom = rows;
     }
+    
+    // Park the cursor below the frame, clearing messages left from earlier commands
+    moveCursor(output, frame.size(), 0);
+    output += "\x1b[J";
+    shown = frame;
 }
 
-
+void TextObserver::display() {
+    // Rows left below an ANSI frame for messages and input
+    constexpr int MESSAGE_ROWS = 2;
+    
+    compose();
+    
+    output.clear();
+    int rows = ansi ? terminalRows() : 0;
+    if (rows >= static_cast<int>(frame.size()) + MESSAGE_ROWS) {
+        diff(rows);
+    } else {
+        // Plain mode, or a terminal too short to hold the frame: print it in full
+        leaveScreen();
+        for (const auto& line : frame) {
+            output += line;
+            output += '\n';
+        }
+    }
+    
+    // One write (and one flush) per frame
+    std::cout.write(output.data(), static_cast<std::streamsize>(output.size()));
+    std::cout.flush();
+}
@@ -9,6 +9,8 @@
 
 export module textobserver;
 
+import <string>;
+import <vector>;
 import observer;
 import player;
 import board;
@@ -24,6 +26,15 @@ import board;
  * Observer observes Player (Subject) and gets all information from Player,
  * including Board, Block, Position, Score, and Level. This follows proper
  * Observer pattern design where Observer only accesses Subject.
+ * 
+ * Each frame is composed as text lines and written with a single buffered
+ * write. In plain mode every frame is printed in full (the format scripts
+ * and transcripts rely on). In ANSI mode the frame is drawn at the top of
+ * the terminal's alternate screen, with messages scrolling in the rows
+ * below it; the previous frame is kept and only the cells that changed are
+ * redrawn, which keeps interactive play responsive over slow terminals.
+ * When standard output is not a terminal, or the terminal is too short for
+ * the frame, ANSI mode prints full frames like plain mode.
  */
 export class TextObserver : public Observer {
 protected:
@@ -31,13 +42,36 @@ protected:
     Player* player1;    ///< Pointer to player 1 (non-owning, Subject)
     Player* player2;    ///< Pointer to player 2 (non-owning, Subject)
     
+private:
+    bool ansi;                        ///< Redraw changed cells only (ANSI terminals)
+    std::vector<std::string> frame;   ///< Lines of the frame being composed
+    std::vector<std::string> shown;   ///< Lines on screen (ANSI mode)
+    std::string output;               ///< Bytes written for one frame
+    int scrollTop = 0;                ///< First row of the message scroll region (ANSI mode)
+    int scrollBottom = 0;             ///< Last row of the message scroll region (ANSI mode)
+    
+    // Fills `frame` with the current game state
+    void compose();
+    // Appends the escapes that turn `shown` into `frame` to `output`, for a
+    // terminal of `rows` rows
+    void diff(int rows);
+    // Appends the escapes that leave the ANSI screen, if it is in use
+    void leaveScreen();
+    
 public:
     /**
      * @brief Constructs a TextObserver for two players
      * @param p1 Pointer to player 1 (non-owning, Subject)
      * @param p2 Pointer to player 2 (non-owning, Subject)
+     * @param ansi true to redraw only changed cells with ANSI escapes,
+     *        false to print every frame in full
+     */
+    TextObserver(Player* p1, Player* p2, bool ansi = false);
+    
+    /**
+     * @brief Restores the terminal if ANSI mode took it over
      */
-    TextObserver(Player* p1, Player* p2);
+    ~TextObserver();
     
     /**
      * @brief Called when the observed subject changes state
@@ -53,7 +87,8 @@ public:
      * 
      * This method gets all information from Player and prints the game
      * boards, player info, and UI elements to the console using ASCII
-     * characters and formatting.
+     * characters and formatting. In ANSI mode only the changes since the
+     * previous frame are written, and the cursor is left below the frame.
      */
     void display();
 };
@@ -0,0 +1,211 @@
+/**
+ * @file tournament.cc
+ * @brief Parallel round-robin tournament between bot configurations
+ *
+ * Every ordered pair of bot configurations plays a number of games (each
+ * bot gets both seats), spread over all cores:
+ * - matches are numbered up front; match m uses seed base + m, so results
+ *   do not depend on which thread plays which match
+ * - each worker starts with an even share of the match numbers and takes
+ *   them from the front of its range; when it runs out it steals the back
+ *   half of the fullest remaining range
+ * - each worker owns its HintFinder, and every match builds its own Game
+ *   (with per-player generators seeded from the match seed), so workers
+ *   share no engine state
+ * - a match writes its result into its own slot, and the slots are merged
+ *   after the workers are joined, so recording results needs no locks
+ *
+ * Usage: ./biquadris-tournament [-games n] [-threads n] [-seed base]
+ *                               [-startlevel n] [-maxdrops n]
+ */
+
+import <iostream>;
+import <string>;
+import <vector>;
+import <atomic>;
+import <thread>;
+import <chrono>;
+import <cstdint>;
+import hint;
+import selfplay;
+
+using namespace std;
+
+struct Bot {
+    string name;
+    WeightedHeuristic heuristic;
+};
+
+static vector<Bot> makeBots() {
+    vector<Bot> bots(4);
+    bots[0].name = "default";
+    bots[1].name = "flat";
+    bots[1].heuristic.bumpinessWeight = -0.40;
+    bots[1].heuristic.holeWeight = -0.50;
+    bots[2].name = "greedy";
+    bots[2].heuristic.linesWeight = 1.50;
+    bots[2].heuristic.scoreWeight = 0.10;
+    bots[3].name = "careful";
+    bots[3].heuristic.holeWeight = -1.00;
+    bots[3].heuristic.heightWeight = -0.80;
+    return bots;
+}
+
+// A worker's remaining matches [begin, end), packed into one word so that
+// the owner and thieves can both claim matches with a single CAS
+struct alignas(64) MatchRange {
+    atomic<uint64_t> packed{0};
+
+    static uint64_t pack(uint32_t begin, uint32_t end) {
+        return static_cast<uint64_t>(begin) << 32 | end;
+    }
+    static uint32_t beginOf(uint64_t r) { return static_cast<uint32_t>(r >> 32); }
+    static uint32_t endOf(uint64_t r) { return static_cast<uint32_t>(r); }
+
+    // Owner: claims the first remaining match
+    bool take(uint32_t& match) {
+        uint64_t r = packed.load();
+        while (beginOf(r) < endOf(r)) {
+            if (packed.compare_exchange_weak(r, pack(beginOf(r) + 1, endOf(r)))) {
+                match = beginOf(r);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Thief: claims the back half of the remaining matches
+    bool steal(uint32_t& begin, uint32_t& end) {
+        uint64_t r = packed.load();
+        while (beginOf(r) < endOf(r)) {
+            uint32_t mid = beginOf(r) + (endOf(r) - beginOf(r)) / 2;
+            if (packed.compare_exchange_weak(r, pack(beginOf(r), mid))) {
+                begin = mid;
+                end = endOf(r);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    uint32_t remaining() const {
+        uint64_t r = packed.load();
+        return beginOf(r) < endOf(r) ? endOf(r) - beginOf(r) : 0;
+    }
+};
+
+int main(int argc, char* argv[]) {
+    MatchOptions options;
+    options.startLevel = 1;
+    int gamesPerPairing = 50;
+    unsigned int threads = thread::hardware_concurrency();
+    unsigned int baseSeed = 1;
+    for (int i = 1; i < argc; ++i) {
+        string arg = argv[i];
+        if (arg == "-games" && i + 1 < argc) {
+            gamesPerPairing = stoi(argv[++i]);
+        } else if (arg == "-threads" && i + 1 < argc) {
+            threads = stoul(argv[++i]);
+        } else if (arg == "-seed" && i + 1 < argc) {
+            baseSeed = stoul(argv[++i]);
+        } else if (arg == "-startlevel" && i + 1 < argc) {
+            options.startLevel = stoi(argv[++i]);
+            if (options.startLevel < 0) options.startLevel = 0;
+            if (options.startLevel > 4) options.startLevel = 4;
+        } else if (arg == "-maxdrops" && i + 1 < argc) {
+            options.maxDrops = stoll(argv[++i]);
+        }
+    }
+    if (threads == 0) threads = 1;
+    if (gamesPerPairing <= 0) {
+        cerr << "Error: -games must be positive" << endl;
+        return 1;
+    }
+
+    const vector<Bot> bots = makeBots();
+    const int botCount = static_cast<int>(bots.size());
+
+    // Ordered pairings: bot a plays player 1, bot b plays player 2
+    struct Pairing { int a; int b; };
+    vector<Pairing> pairings;
+    for (int a = 0; a < botCount; ++a) {
+        for (int b = 0; b < botCount; ++b) {
+            if (a != b) pairings.push_back(Pairing{a, b});
+        }
+    }
+    const uint32_t matchCount = static_cast<uint32_t>(pairings.size() * gamesPerPairing);
+    vector<MatchResult> results(matchCount);
+
+    vector<MatchRange> ranges(threads);
+    for (unsigned int t = 0; t < threads; ++t) {
+        uint32_t begin = static_cast<uint32_t>(static_cast<uint64_t>(matchCount) * t / threads);
+        uint32_t end = static_cast<uint32_t>(static_cast<uint64_t>(matchCount) * (t + 1) / threads);
+        ranges[t].packed.store(MatchRange::pack(begin, end));
+    }
+    atomic<long long> steals{0};
+
+    auto worker = [&](unsigned int self) {
+        HintFinder finder;
+        while (true) {
+            uint32_t match;
+            while (ranges[self].take(match)) {
+                const Pairing& p = pairings[match / gamesPerPairing];
+                results[match] = playMatch(baseSeed + match, options, finder,
+                                           bots[p.a].heuristic, bots[p.b].heuristic);
+            }
+
+            // Out of work: steal from the fullest range, or stop if all are empty
+            unsigned int victim = self;
+            uint32_t most = 0;
+            for (unsigned int t = 0; t < ranges.size(); ++t) {
+                uint32_t left = ranges[t].remaining();
+                if (left > most) {
+                    most = left;
+                    victim = t;
+                }
+            }
+            if (most == 0) return;
+
+            uint32_t begin, end;
+            if (ranges[victim].steal(begin, end)) {
+                ranges[self].packed.store(MatchRange::pack(begin, end));
+                steals.fetch_add(1, memory_order_relaxed);
+            }
+        }
+    };
+
+    auto start = chrono::steady_clock::now();
+    vector<thread> pool;
+    for (unsigned int t = 0; t < threads; ++t) pool.emplace_back(worker, t);
+    for (auto& th : pool) th.join();
+    double elapsed = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+    // Merge per-match results
+    struct Standing { long long games = 0, wins = 0, losses = 0, draws = 0, score = 0; };
+    vector<Standing> standings(botCount);
+    long long drops = 0;
+    for (uint32_t m = 0; m < matchCount; ++m) {
+        const Pairing& p = pairings[m / gamesPerPairing];
+        const MatchResult& r = results[m];
+        Standing& first = standings[p.a];
+        Standing& second = standings[p.b];
+        ++first.games;
+        ++second.games;
+        first.score += r.score1;
+        second.score += r.score2;
+        if (r.winner == 1) { ++first.wins; ++second.losses; }
+        else if (r.winner == 2) { ++second.wins; ++first.losses; }
+        else { ++first.draws; ++second.draws; }
+        drops += r.drops;
+    }
+
+    cout << "matches: " << matchCount << " on " << threads << " threads in " << elapsed << " s ("
+         << matchCount / elapsed << " games/s, " << static_cast<long long>(drops / elapsed)
+         << " drops/s, " << steals.load() << " steals)" << endl;
+    for (int b = 0; b < botCount; ++b) {
+        const Standing& s = standings[b];
+        cout << bots[b].name << ": " << s.wins << " W " << s.losses << " L " << s.draws
+             << " D, average score " << static_cast<double>(s.score) / s.games << endl;
+    }
+    return 0;
+}
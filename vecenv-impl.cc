@@ -0,0 +1,121 @@
+// VecEnv module - implementation
+module vecenv;
+
+import <cstddef>;
+import <cstdint>;
+import <span>;
+import <stdexcept>;
+import <vector>;
+import action;
+import block;
+import board;
+import game;
+import player;
+import position;
+
+// Observation code of a block: 1-7 for I, J, L, O, S, T, Z, 0 for none
+static std::uint8_t blockCode(const Block* block) {
+    if (!block) return 0;
+    switch (block->getSymbol()) {
+        case 'I': return 1;
+        case 'J': return 2;
+        case 'L': return 3;
+        case 'O': return 4;
+        case 'S': return 5;
+        case 'T': return 6;
+        case 'Z': return 7;
+        default: return 0;
+    }
+}
+
+// Writes a board's occupancy (ignoring the blind effect) as 0/1 bytes
+static void writeBoard(const Board& board, std::uint8_t* out) {
+    for (int r = 0; r < Board::getRows(); ++r) {
+        for (int c = 0; c < Board::getCols(); ++c) {
+            *out++ = board.isOccupied(r, c) ? 1 : 0;
+        }
+    }
+}
+
+// Throws unless a caller's buffer holds at least needed elements
+static void requireSize(std::size_t size, int needed, const char* what) {
+    if (size < static_cast<std::size_t>(needed)) {
+        throw std::invalid_argument{what};
+    }
+}
+
+VecEnv::VecEnv(int count, std::uint64_t seed) : games(count) {
+    for (int i = 0; i < count; ++i) {
+        games[i].setSeed(seed + i);
+        games[i].restart();
+    }
+}
+
+int VecEnv::size() const {
+    return static_cast<int>(games.size());
+}
+
+void VecEnv::reset(std::span<std::uint8_t> observations) {
+    requireSize(observations.size(), size() * OBSERVATION_SIZE, "VecEnv::reset: observations too short");
+    for (int i = 0; i < size(); ++i) {
+        games[i].restart();
+        observe(games[i], observations.data() + i * OBSERVATION_SIZE);
+    }
+}
+
+void VecEnv::step(std::span<const Action> actions, std::span<std::uint8_t> observations,
+                  std::span<float> rewards, std::span<std::uint8_t> done) {
+    requireSize(actions.size(), size(), "VecEnv::step: actions too short");
+    requireSize(observations.size(), size() * OBSERVATION_SIZE, "VecEnv::step: observations too short");
+    requireSize(rewards.size(), size(), "VecEnv::step: rewards too short");
+    requireSize(done.size(), size(), "VecEnv::step: done too short");
+    for (int i = 0; i < size(); ++i) {
+        Game& game = games[i];
+        Player& player = *game.getCurrentPlayer();
+        int scoreBefore = player.getScore();
+
+        switch (actions[i]) {
+            case Action::Left:
+            case Action::Right:
+            case Action::Down: player.move(actions[i]); break;
+            case Action::Clockwise:
+            case Action::CounterClockwise: player.rotate(actions[i]); break;
+            case Action::Drop:
+                player.drop();
+                if (game.canApplySpecial()) game.applySpecialEffect("heavy");
+                game.switchTurn();
+                game.getCurrentPlayer()->spawnBlock();
+                break;
+        }
+
+        rewards[i] = static_cast<float>(player.getScore() - scoreBefore);
+        done[i] = game.isGameOver() ? 1 : 0;
+        if (done[i]) game.restart();
+        observe(game, observations.data() + i * OBSERVATION_SIZE);
+    }
+}
+
+void VecEnv::observe(Game& game, std::uint8_t* out) {
+    Player& self = *game.getCurrentPlayer();
+    Player& opponent = (&self == game.getPlayer1().get()) ? *game.getPlayer2() : *game.getPlayer1();
+
+    writeBoard(*self.getBoard(), out);
+    if (const Block* current = self.getCurBlock()) {
+        Position pos = self.getCurPos();
+        for (const auto& cell : current->getCells()) {
+            int r = pos.row + cell.row;
+            int c = pos.col + cell.col;
+            if (r >= 0 && r < Board::getRows() && c >= 0 && c < Board::getCols()) {
+                out[r * Board::getCols() + c] = 2;
+            }
+        }
+    }
+    writeBoard(*opponent.getBoard(), out + BOARD_CELLS);
+
+    std::uint8_t* info = out + 2 * BOARD_CELLS;
+    info[0] = blockCode(self.getCurBlock());
+    info[1] = blockCode(self.getNextBlock());
+    info[2] = blockCode(self.getHeldBlock());
+    info[3] = static_cast<std::uint8_t>(self.getLevel());
+    info[4] = (&self == game.getPlayer1().get()) ? 1 : 2;
+}
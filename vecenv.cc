@@ -0,0 +1,86 @@
+/**
+ * @file vecenv.cc
+ * @brief Interface for the VecEnv class (batched environments for training)
+ *
+ * This file defines VecEnv, which steps N independent two-player games in
+ * lockstep with one call. It is meant for reinforcement learning loops:
+ * actions come in as an array, and observations, rewards and done flags
+ * are written into caller-provided contiguous buffers.
+ */
+
+export module vecenv;
+
+import <cstdint>;
+import <span>;
+import <vector>;
+import action;
+import board;
+import game;
+
+/**
+ * @class VecEnv
+ * @brief N Biquadris games stepped together, one action per game per step
+ *
+ * Each environment is a Game. A step applies one Action to that game's
+ * current player by calling Player::move/rotate/drop directly, which skips
+ * the command dispatch in Game::handleCommand. After a drop the turn passes
+ * to the other player and their block spawns, as in main.cc; a drop that
+ * clears 2+ rows makes the opponent heavy. No observers are attached.
+ *
+ * When a game ends, its done flag is set and it is restarted through
+ * Game::restart(), so the observation written for that step is already the
+ * first one of the next game.
+ *
+ * Observations are taken from the view of the player who acts next
+ * (OBSERVATION_SIZE bytes per environment):
+ * - ROWS x COLS own board, row-major: 0 empty, 1 filled, 2 current block
+ * - ROWS x COLS opponent's board: 0 empty, 1 filled
+ * - current, next and held block (1-7 for I, J, L, O, S, T, Z; 0 none)
+ * - own level and player number (1 or 2)
+ *
+ * The reward is the score the player who took the action gained by it.
+ */
+export class VecEnv {
+public:
+    static constexpr int BOARD_CELLS = Board::getRows() * Board::getCols();
+    static constexpr int OBSERVATION_SIZE = 2 * BOARD_CELLS + 5;
+
+    /**
+     * @brief Creates the environments and starts a game in each
+     * @param count Number of environments
+     * @param seed Seed of environment 0; environment i uses seed + i
+     */
+    explicit VecEnv(int count, std::uint64_t seed = 1);
+
+    /**
+     * @brief Gets the number of environments
+     */
+    int size() const;
+
+    /**
+     * @brief Restarts every game and writes the first observations
+     * @param observations size() * OBSERVATION_SIZE bytes
+     * @throws std::invalid_argument if observations is too short
+     */
+    void reset(std::span<std::uint8_t> observations);
+
+    /**
+     * @brief Applies one action to each game
+     * @param actions One action per environment
+     * @param observations size() * OBSERVATION_SIZE bytes, overwritten
+     * @param rewards One reward per environment, overwritten
+     * @param done One flag per environment, overwritten: 1 if its game
+     *             ended (and was restarted) during this step, else 0
+     * @throws std::invalid_argument if any buffer is too short
+     */
+    void step(std::span<const Action> actions, std::span<std::uint8_t> observations,
+              std::span<float> rewards, std::span<std::uint8_t> done);
+
+private:
+    std::vector<Game> games;
+
+    /**
+     * @brief Writes one game's observation from the view of its current player
+     */
+    void observe(Game& game, std::uint8_t* out);
+};
@@ -18,6 +18,7 @@ struct XWindow::XWindowImpl {
     GC gc;
     unsigned long colors[12];
     int width, height;
+    bool exposed = false;  // part of the window was uncovered since wasExposed()
 };
 
 XWindow::XWindow(int w, int h) : pImpl{std::make_unique<XWindowImpl>()} {
@@ -105,11 +106,23 @@ void XWindow::drawRectangle(int x, int y, int w, int h, int color) {
     XFlush(pImpl->d);
 }
 
+void XWindow::setClip(int x, int y, int w, int h) {
+    XRectangle rect{static_cast<short>(x), static_cast<short>(y),
+                    static_cast<unsigned short>(w), static_cast<unsigned short>(h)};
+    XSetClipRectangles(pImpl->d, pImpl->gc, 0, 0, &rect, 1, Unsorted);
+}
+
+void XWindow::clearClip() {
+    XSetClipMask(pImpl->d, pImpl->gc, None);
+}
+
 bool XWindow::checkEvent(std::string& key) {
     XEvent event;
     if (XPending(pImpl->d) > 0) {
         XNextEvent(pImpl->d, &event);
-        if (event.type == KeyPress) {
+        if (event.type == Expose) {
+            pImpl->exposed = true;
+        } else if (event.type == KeyPress) {
             KeySym keysym = XLookupKeysym(&event.xkey, 0);
             
             // Arrow keys
@@ -162,3 +175,8 @@ bool XWindow::checkEvent(std::string& key) {
     return false;
 }
 
+bool XWindow::wasExposed() {
+    bool exposed = pImpl->exposed;
+    pImpl->exposed = false;
+    return exposed;
+}
@@ -80,6 +80,23 @@ public:
      */
     void drawRectangle(int x, int y, int width, int height, int color = 0);
     
+    /**
+     * @brief Restricts drawing to a rectangle
+     * @param x X coordinate of top-left corner
+     * @param y Y coordinate of top-left corner
+     * @param width Rectangle width
+     * @param height Rectangle height
+     * 
+     * Pixels outside the rectangle are left untouched by later drawing calls
+     * until clearClip() is called.
+     */
+    void setClip(int x, int y, int width, int height);
+    
+    /**
+     * @brief Lifts the restriction set by setClip()
+     */
+    void clearClip();
+    
     /**
      * @brief Checks for keyboard events (non-blocking)
      * @param key Output parameter: key string if event found
@@ -91,6 +108,15 @@ public:
      */
     bool checkEvent(std::string& key);
     
+    /**
+     * @brief Checks whether part of the window was uncovered
+     * @return true if an expose event arrived since the last call
+     * 
+     * The uncovered area must be redrawn; X does not keep the contents of
+     * covered windows. Expose events are read by checkEvent().
+     */
+    bool wasExposed();
+    
     /**
      * @enum Color
      * @brief Available colors for drawing
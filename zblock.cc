@@ -3,13 +3,11 @@ export module zblock;
 
 import block;
 
+/*
+ * ZBlock:
+ * Selects the 'Z' shape; rotation data lives in the shared SHAPES table.
+ */
 export class ZBlock : public Block {
-    int rotation = 0;
-    
 public:
     ZBlock(int id, int level);
-    void rotateCW() override;
-    void rotateCCW() override;
 };
-
-